@@ -4,9 +4,8 @@
 
 #include "BaseGlContext.h"
 
-#include <iomanip>
+#include <cstdio>
 #include <iostream>
-#include <sstream>
 
 #define GL_NO_ERROR   0
 #define GL_VENDOR     0x1F00
@@ -16,16 +15,19 @@
 #define GL_SHADING_LANGUAGE_VERSION 0x8B8C
 #define GL_NUM_EXTENSIONS 0x821D
 
+bool BaseGlContext::SoftMesaSentry::IsSoftRenderer(const std::string& theVendor, const std::string& theRenderer)
+{
+  return theVendor == "Mesa" && theRenderer.find("llvmpipe") != std::string::npos;
+}
+
 bool BaseGlContext::SoftMesaSentry::IsSoftContext(BaseGlContext& theDefCtx)
 {
-  const std::string aVendor = theDefCtx.GlGetString(GL_VENDOR);
-  const std::string aRender = theDefCtx.GlGetString(GL_RENDERER);
-  return aVendor == "Mesa" && aRender.find("llvmpipe") != std::string::npos;
+  return IsSoftRenderer(theDefCtx.GlGetString(GL_VENDOR), theDefCtx.GlGetString(GL_RENDERER));
 }
 
-bool BaseGlContext::SoftMesaSentry::Init(BaseGlContext& theDefCtx)
+bool BaseGlContext::SoftMesaSentry::Init(bool theIsDefaultSoft)
 {
-  if (IsSoftContext(theDefCtx))
+  if (theIsDefaultSoft)
     return false;
 
   myToRestore = true;
@@ -76,236 +78,53 @@ const char* BaseGlContext::getColorBufferClass(int theNbColorBits, int theNbRedB
   return "TrueColor";
 }
 
-void BaseGlContext::VisualInfo::PrintTableSeparator()
-{
-  std::cout << "  - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - \n";
-}
-
-void BaseGlContext::VisualInfo::PrintTableHeader(bool theHeader)
+bool BaseGlContext::updateVersionHint(VersionHint& theHint)
 {
-  if (theHeader)
+  const char* aVersion = GlGetString(GL_VERSION);
+  int aMajor = 0, aMinor = 0;
+  if (aVersion == nullptr
+   || sscanf(aVersion, "%d.%d", &aMajor, &aMinor) != 2)
   {
-    std::cout << "      visual  bf lv rg d st  colorbuffer  sr ax dp st accumbuffer msaa  cav\n"
-                 "  id  dep cl  sz l  ci b ro  r  g  b  a F gb bf th cl  r  g  b  a ns  b eat\n"
-                 "------------------------------------------------------------------------"
-              << std::endl;
-  }
-  else
-  {
-    std::cout << "------------------------------------------------------------------------\n"
-                 "  id  dep cl  bf lv rg d st  r  g  b  a F sr ax dp st  r  g  b  a ns  b cav\n"
-                 "      visual  sz l  ci b ro  colorbuffer  gb bf th cl accumbuffer msaa  eat\n"
-                 "------------------------------------------------------------------------\n"
-              << std::endl;
+    return false;
   }
+
+  theHint.Major = aMajor;
+  theHint.Minor = aMinor;
+  return true;
 }
 
-void BaseGlContext::VisualInfo::PrintTableLine(bool theIsHexConfigId)
+//! Return string or empty string for NULL.
+static const char* safeString(const char* theStr)
 {
-  std::stringstream aStr;
-
-  const auto printInt2d = [&aStr](int theInt, int theNA = -1) -> void
-  {
-    if (theInt <= theNA)
-      aStr << " . ";
-    else
-      aStr << std::setw(2) << theInt << " ";
-  };
-
-  const auto printInt3d = [&aStr](int theInt) -> void
-  {
-    if (theInt < 0)
-      aStr << "  . ";
-    else
-      aStr << std::setw(3) << theInt << " ";
-  };
-
-  if (theIsHexConfigId && ConfigId >= 0x1000)
-    aStr << std::hex << std::setw(5) << std::setfill('0')
-         << ConfigId << std::dec << std::setfill(' ') << " ";
-  else if (theIsHexConfigId)
-    aStr << "0x" << std::hex << std::setw(3) << std::setfill('0')
-         << ConfigId << std::dec << std::setfill(' ') << " ";
-  else
-    aStr << std::setw(5) << ConfigId << " ";
-
-  if (ColorDepth == 0 && ColorBufferSize != 0 && BufferType == ColorBuffer_Rgba)
-  {
-    // color depth excluding alpha
-    if (RedSize != 0)
-      printInt3d(RedSize + GreenSize + BlueSize);
-    else if (AlphaSize == 2 && ColorBufferSize == 32)
-      printInt3d(30);
-    else if (AlphaSize == 8 && ColorBufferSize == 32)
-      printInt3d(24);
-    else
-      printInt3d(ColorBufferSize);
-  }
-  else
-  {
-    printInt3d(ColorDepth);
-  }
-
-  if ((SurfaceType & Surface_Window) != 0)
-  {
-    if ((SurfaceType & Surface_Pixmap) != 0 || (SurfaceType & Surface_PBuffer) != 0
-        || (SurfaceType & Surface_PBufferRemote) != 0)
-      aStr << "wb ";
-    else
-      aStr << "wn ";
-  }
-  else if ((SurfaceType & Surface_Pixmap) != 0 || (SurfaceType & Surface_PBuffer) != 0
-           || (SurfaceType & Surface_PBufferRemote) != 0)
-  {
-    aStr << "bm ";
-  }
-  else
-  {
-    aStr << " . ";
-  }
-
-  // x sp
-  //aStr << " . ";
-
-  // color buffer size
-  printInt3d(ColorBufferSize);
-
-  // number of over/underlays
-  aStr << " . ";
-
-  // color type
-  switch (BufferType)
-  {
-    case ColorBuffer_ColorIndex: aStr << 'i'; break;
-    case ColorBuffer_Luminance:  aStr << 'l'; break;
-    case ColorBuffer_Rgba:       aStr << 'r'; break;
-  }
-  aStr << "  ";
-
-  // double buffer
-  aStr << (SwapIntervalMax >= 1 ? 'y' : '.') << " ";
-
-  // stereo buffer
-  aStr << (IsStereoBuffer ? 'y' : '.') << "  ";
-
-  // RGBA components bits
-  printInt2d(RedSize,   BufferType != ColorBuffer_Rgba ? 0 : -1);
-  printInt2d(GreenSize, BufferType != ColorBuffer_Rgba ? 0 : -1);
-  printInt2d(BlueSize,  BufferType != ColorBuffer_Rgba ? 0 : -1);
-  printInt2d(AlphaSize, BufferType != ColorBuffer_Rgba ? 0 : -1);
-  // float
-  aStr << (IsColorFloat ? 'y' : '.') << " ";
-  // srgb
-  aStr << " " << (IsSRgb ? 's' : '.') << " ";
-
-  printInt2d(NbAuxBuffers, 0);
-  printInt2d(DepthSize);
-  printInt2d(StencilSize);
-
-  // accumulation buffer components bits
-  printInt2d(AccumRedSize,   0);
-  printInt2d(AccumGreenSize, 0);
-  printInt2d(AccumBlueSize,  0);
-  printInt2d(AccumAlphaSize, 0);
-
-  // ms: ns  b
-  aStr << " " << NbSampleBuffers << " ";
-  printInt2d(NbSamples, -1);
-
-  // swap
-  //aStr << ".  ";
-
-  // caveat
-  if (IsSoftware)
-    aStr << "Software ";
-  else if (ConfigCaveat == 0)
-    aStr << "None ";
-
-  if ((ConfigCaveat & Caveat_Slow) != 0)
-    aStr << "Slow ";
-
-  if ((ConfigCaveat & Caveat_NonConformant) != 0)
-    aStr << "NonConformant ";
-
-  std::cout << aStr.str() << std::endl;
+  return theStr != nullptr ? theStr : "";
 }
 
-static const int THE_LINE_LEN = 80;
-void BaseGlContext::printExtensions(const char* theExt)
+void BaseGlContext::CollectRendererInfo(RendererReport& theReport)
 {
-  if (theExt == nullptr)
+  theReport.Sections |= RendererReport::Section_Renderer;
+  theReport.Vendor   = safeString(GlGetString(GL_VENDOR));
+  theReport.Renderer = safeString(GlGetString(GL_RENDERER));
+  theReport.Version  = safeString(GlGetString(GL_VERSION));
+  if (const char* aGlslVer = (const char* )GlGetString(GL_SHADING_LANGUAGE_VERSION))
   {
-    std::cout << "    NULL.\n\n";
-    return;
+    theReport.ShadingLanguageVersion = aGlslVer;
+    theReport.HasShadingLanguageVersion = true;
   }
-
-  std::stringstream aStr;
-  int aStart = 0, aLineLen = 0;
-  for (int aCharIter = 0;; ++aCharIter)
+  else
   {
-    bool toBreak = theExt[aCharIter] == '\0';
-    if (theExt[aCharIter] == ' '
-     || theExt[aCharIter] == '\0')
-    {
-      const int aLen = aCharIter - aStart;
-      for (; theExt[aCharIter] == ' '; ++aCharIter) {} // skip extra spaces
-      if (theExt[aCharIter] == '\0')
-        toBreak = true;
-
-      if (aLen > 0)
-      {
-        if (aLineLen != 0 && aLineLen + aLen + 2 > THE_LINE_LEN)
-        {
-          aStr << "\n";
-          aLineLen = 0;
-        }
-        if (aLineLen == 0)
-        {
-          aLineLen += 4;
-          aStr << "    ";
-        }
-        else
-        {
-          aLineLen += 1;
-          aStr << " ";
-        }
-
-        aLineLen += aLen + 1;
-        aStr.write(theExt + aStart, aLen);
-        aStr << (toBreak ? "." : ",");
-      }
-      aStart = aCharIter;
-    }
-    if (toBreak)
-    {
-      aStr << "\n";
-      std::cout << aStr.str() << std::endl;
-      return;
-    }
+    GlGetError();
   }
 }
 
-void BaseGlContext::PrintRendererInfo()
-{
-    std::cout << Prefix() << "vendor   string: " << GlGetString(GL_VENDOR)   << "\n"
-              << Prefix() << "renderer string: " << GlGetString(GL_RENDERER) << "\n"
-              << Prefix() << "version  string: " << GlGetString(GL_VERSION)  << "\n";
-    if (const char* aGlslVer = (const char* )GlGetString(GL_SHADING_LANGUAGE_VERSION))
-      std::cout << Prefix() << "shading language version string: " << aGlslVer << "\n";
-    else
-      GlGetError();
-}
-
-void BaseGlContext::PrintGpuMemoryInfo()
+void BaseGlContext::CollectGpuMemoryInfo(RendererReport& theReport)
 {
+  theReport.Sections |= RendererReport::Section_GpuMemory;
   {
     //if (checkGlExtension("GL_ATI_meminfo"))
     int aMemInfo[4] = {-1, -1, -1, -1};
     GlGetIntegerv(0x87FB, aMemInfo); // GL_VBO_FREE_MEMORY_ATI = 0x87FB
     if (GlGetError() == GL_NO_ERROR && aMemInfo[0] != -1)
-    {
-      std::cout << Prefix() << "Free GPU memory: " << (aMemInfo[0] / 1024) << " MiB\n";
-    }
+      theReport.AddGpuMemory("freeMiB", "Free GPU memory", aMemInfo[0] / 1024);
   }
   {
     //if (checkGlExtension("GL_NVX_gpu_memory_info"))
@@ -313,43 +132,44 @@ void BaseGlContext::PrintGpuMemoryInfo()
     GlGetIntegerv(0x9047, &aDedicated); // GL_GPU_MEMORY_INFO_DEDICATED_VIDMEM_NVX = 0x9047
     if (GlGetError() == GL_NO_ERROR && aDedicated != -1)
     {
-      std::cout << Prefix() << "GPU memory: " << (aDedicated / 1024) << " MiB\n";
+      theReport.AddGpuMemory("dedicatedMiB", "GPU memory", aDedicated / 1024);
       //GLint aDedicatedFree = -1;
       //GlGetIntegerv(0x9049, &aDedicatedFree); // GL_GPU_MEMORY_INFO_CURRENT_AVAILABLE_VIDMEM_NVX = 0x9049
-      //std::cout << Prefix() << "Free GPU memory: " << (aDedicatedFree / 1024) << " MiB\n";
     }
   }
 }
 
-std::string BaseGlContext::getGlExtensions()
+const std::string& BaseGlContext::getGlExtensions()
 {
-  if ((myCtxBits & ContextBits_GLES) != 0)
-    return ((const char*)GlGetString(GL_EXTENSIONS));
-  else if ((myCtxBits & ContextBits_CoreProfile) == 0 && (myCtxBits & ContextBits_ForwardProfile) == 0)
-    return ((const char*)GlGetString(GL_EXTENSIONS));
+  if (myHasGlExtensions)
+    return myGlExtensions;
+
+  myHasGlExtensions = true;
+  if ((myCtxBits & ContextBits_GLES) != 0
+   || ((myCtxBits & ContextBits_CoreProfile) == 0 && (myCtxBits & ContextBits_ForwardProfile) == 0))
+  {
+    myGlExtensions = safeString(GlGetString(GL_EXTENSIONS));
+    return myGlExtensions;
+  }
 
   int anExtNb = 0;
   GlGetIntegerv(GL_NUM_EXTENSIONS, &anExtNb);
-
-  std::string aList;
   for (int anExtIter = 0; anExtIter < anExtNb; ++anExtIter)
   {
     const char* anExtension = (const char*)GlGetStringi(GL_EXTENSIONS, anExtIter);
     if (anExtension != NULL)
     {
-      aList += std::string(anExtension);
-      aList += std::string(" ");
+      myGlExtensions += anExtension;
+      myGlExtensions += ' ';
     }
-    //const size_t aTestExtNameLen = strlen (anExtension);
   }
-  return aList.c_str();
+  return myGlExtensions;
 }
 
-void BaseGlContext::PrintExtensions()
+void BaseGlContext::CollectExtensions(RendererReport& theReport)
 {
-  std::cout << Prefix() << "extensions:\n";
-  const std::string anExtList = getGlExtensions();
-  printExtensions(anExtList.c_str());
+  theReport.Sections |= RendererReport::Section_Extensions;
+  RendererReport::SplitExtensions(getGlExtensions().c_str(), theReport.Extensions);
 }
 
 #define GL_MAX_VIEWPORT_DIMS              0x0D3A
@@ -400,40 +220,32 @@ void BaseGlContext::PrintExtensions()
 #define GL_MAX_VERTEX_ATTRIB_RELATIVE_OFFSET 0x82D9
 #define GL_MAX_VERTEX_ATTRIB_BINDINGS     0x82DA
 
-void BaseGlContext::printLimitInt(unsigned int theGlEnum, const char* theName)
+void BaseGlContext::collectLimitInt(RendererReport& theReport, unsigned int theGlEnum, const char* theName)
 {
   int aVal = 0;
   GlGetIntegerv(theGlEnum, &aVal);
   if (GlGetError() != GL_NO_ERROR)
     return;
 
-  std::cout << "  " << theName << " = " << aVal << "\n";
+  theReport.AddLimit(theName, aVal);
 }
 
-void BaseGlContext::printLimitIntRange(unsigned int theGlEnum, const char* theName)
+void BaseGlContext::collectLimitIntRange(RendererReport& theReport, unsigned int theGlEnum, const char* theName)
 {
   int aVal[2] = {0, 0};
   GlGetIntegerv(theGlEnum, aVal);
   if (GlGetError() != GL_NO_ERROR)
     return;
 
-  std::stringstream aStr;
-  aStr << "  " << theName << " = " << aVal[0] << ", " << aVal[1];
-
-  std::cout << aStr.str() << std::endl;
+  theReport.AddLimitRange(theName, aVal[0], aVal[1]);
 }
 
 #define LimitIntValue(theId) LimitDefinition(#theId, theId, 1)
 #define LimitIntRange(theId) LimitDefinition(#theId, theId, 2)
 
-void BaseGlContext::PrintLimits()
+const std::vector<BaseGlContext::LimitDefinition>& BaseGlContext::limitDefinitions()
 {
-  std::cout << Prefix() << "limits:\n";
-
-  const std::string anExtList = getGlExtensions();
-  GlGetError(); // reset error if any
-
-  static const LimitDefinition THE_LIMITS[] =
+  static const std::vector<LimitDefinition> THE_LIMITS =
   {
     // viewport
     LimitIntRange(GL_MAX_VIEWPORT_DIMS),
@@ -479,13 +291,29 @@ void BaseGlContext::PrintLimits()
     LimitIntRange(GL_ALIASED_POINT_SIZE_RANGE),
     LimitIntRange(GL_SMOOTH_POINT_SIZE_RANGE)
   };
+  return THE_LIMITS;
+}
+
+std::vector<std::string> BaseGlContext::LimitNames()
+{
+  std::vector<std::string> aNames;
+  for (const LimitDefinition& aLim : limitDefinitions())
+    aNames.push_back(aLim.Name);
+  return aNames;
+}
+
+void BaseGlContext::CollectLimits(RendererReport& theReport)
+{
+  theReport.Sections |= RendererReport::Section_Limits;
+
+  GlGetError(); // reset error if any
 
-  for (const LimitDefinition& aLim : THE_LIMITS)
+  for (const LimitDefinition& aLim : limitDefinitions())
   {
     if (aLim.NbVals == 2)
-      printLimitIntRange(aLim.Enum, aLim.Name);
+      collectLimitIntRange(theReport, aLim.Enum, aLim.Name);
     else
-      printLimitInt(aLim.Enum, aLim.Name);
+      collectLimitInt(theReport, aLim.Enum, aLim.Name);
   }
 
 #define GL_NUM_SHADING_LANGUAGE_VERSIONS  0x82E9
@@ -498,24 +326,6 @@ void BaseGlContext::PrintLimits()
   if (GlGetError() != GL_NO_ERROR || aNbVers == 0)
     return;
 
-  std::stringstream aStr;
-  aStr << "  GL_SHADING_LANGUAGE_VERSION =";
-  size_t aLineLen = THE_LINE_LEN * 2;
   for (int aVerIter = 0; aVerIter < aNbVers; ++aVerIter)
-  {
-    const std::string aName = GlGetStringi(GL_SHADING_LANGUAGE_VERSION, aVerIter);
-    aLineLen += aName.length();
-    if (aLineLen > THE_LINE_LEN)
-    {
-      aStr << "\n    ";
-      aLineLen = aName.length() + 4;
-    }
-    else if (aVerIter > 0)
-    {
-      aStr << ", ";
-    }
-    aStr << aName;
-  }
-
-  std::cout << aStr.str() << std::endl;
+    theReport.ShadingLanguageVersions.push_back(safeString(GlGetStringi(GL_SHADING_LANGUAGE_VERSION, aVerIter)));
 }
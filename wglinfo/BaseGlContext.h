@@ -5,7 +5,12 @@
 #ifndef BASEGLCONTEXT_HEADER
 #define BASEGLCONTEXT_HEADER
 
+#include "ExtensionSet.h"
+#include "GlFunctions.h"
 #include "NativeWindow.h"
+#include "RendererReport.h"
+
+#include <iostream>
 
 //! Base GL context interface.
 class BaseGlContext
@@ -21,32 +26,73 @@ public:
     ContextBits_GLES           = 0x010,
   };
 
+  //! Platform session (display connection, driver initialization)
+  //! which could be borrowed by several contexts to avoid costly re-initialization per profile.
+  class PlatformSession
+  {
+  public:
+    virtual ~PlatformSession() {}
+  };
+
 public:
 
+  //! Destructor.
+  virtual ~BaseGlContext() {}
+
   //! Return message prefix.
   std::string Prefix() const
   {
-    return std::string("[") + PlatformName() + "] " + ApiName() + ProfileSuffix() + " ";
+    return ProbeLabel(PlatformName(), myCtxBits) + " ";
   }
 
+  //! Return context bits of created context.
+  ContextBits Bits() const { return myCtxBits; }
+
   //! Return rendering API (OpenGL, OpenGL ES, etc.).
-  const char* ApiName() const { return (myCtxBits & ContextBits_GLES) != 0 ? "OpenGL ES" : "OpenGL"; }
+  const char* ApiName() const { return ApiName(myCtxBits); }
 
   //! Return rendering profile.
-  const char* ProfileSuffix() const
+  const char* ProfileSuffix() const { return ProfileSuffix(myCtxBits); }
+
+  //! Return rendering API (OpenGL, OpenGL ES, etc.) for specified context bits.
+  static const char* ApiName(ContextBits theBits) { return (theBits & ContextBits_GLES) != 0 ? "OpenGL ES" : "OpenGL"; }
+
+  //! Return rendering profile for specified context bits.
+  static const char* ProfileSuffix(ContextBits theBits)
   {
-    if ((myCtxBits & ContextBits_GLES) != 0)
+    if ((theBits & ContextBits_GLES) != 0)
       return "";
-    else if ((myCtxBits & ContextBits_CoreProfile) != 0)
-      return (myCtxBits & ContextBits_SoftProfile) != 0 ? " (software, core profile)" : " (core profile)";
-    else if ((myCtxBits & ContextBits_ForwardProfile) != 0)
+    else if ((theBits & ContextBits_CoreProfile) != 0)
+      return (theBits & ContextBits_SoftProfile) != 0 ? " (software, core profile)" : " (core profile)";
+    else if ((theBits & ContextBits_ForwardProfile) != 0)
       return " (forward profile)";
-    else if ((myCtxBits & ContextBits_SoftProfile) != 0)
+    else if ((theBits & ContextBits_SoftProfile) != 0)
       return " (software)";
 
     return "";
   }
 
+  //! Return short profile name (compat, core, forward, soft, soft-core or es) for specified context bits.
+  static const char* ProfileName(ContextBits theBits)
+  {
+    if ((theBits & ContextBits_GLES) != 0)
+      return "es";
+    else if ((theBits & ContextBits_CoreProfile) != 0)
+      return (theBits & ContextBits_SoftProfile) != 0 ? "soft-core" : "core";
+    else if ((theBits & ContextBits_ForwardProfile) != 0)
+      return "forward";
+    else if ((theBits & ContextBits_SoftProfile) != 0)
+      return "soft";
+
+    return "compat";
+  }
+
+  //! Return probe label like "[EGL] OpenGL (core profile)".
+  static std::string ProbeLabel(const char* thePlatform, ContextBits theBits)
+  {
+    return std::string("[") + thePlatform + "] " + ApiName(theBits) + ProfileSuffix(theBits);
+  }
+
   //! Return platform (EGL, WGL, GLX, CGL, etc.).
   virtual const char* PlatformName() const = 0;
 
@@ -59,25 +105,44 @@ public:
   //! Make this GL context active in current thread.
   virtual bool MakeCurrent() = 0;
 
+  //! Return platform session that could be shared with other contexts;
+  //! NULL if platform doesn't support sharing or context was not yet created.
+  const std::shared_ptr<PlatformSession>& Session() const { return mySession; }
+
+  //! Set platform session to be borrowed by this context;
+  //! should be called before CreateGlContext(). Incompatible sessions are ignored.
+  void SetSession(const std::shared_ptr<PlatformSession>& theSession) { mySession = theSession; }
+
 public:
 
-  //! Print platform info.
-  virtual void PrintPlatformInfo(bool theToPrintExtensions) = 0;
+  //! Initialize report header (platform name and context bits).
+  void InitReport(RendererReport& theReport) const
+  {
+    theReport.Platform = PlatformName();
+    theReport.ContextBits = myCtxBits;
+  }
+
+  //! Collect platform info.
+  virtual void CollectPlatformInfo(RendererReport& theReport, bool theToCollectExtensions) = 0;
+
+  //! Collect renderer info.
+  virtual void CollectRendererInfo(RendererReport& theReport);
 
-  //! Print renderer info.
-  virtual void PrintRendererInfo();
+  //! Collect GPU memory info.
+  virtual void CollectGpuMemoryInfo(RendererReport& theReport);
 
-  //! Print GPU memory info.
-  virtual void PrintGpuMemoryInfo();
+  //! Collect renderer extensions.
+  virtual void CollectExtensions(RendererReport& theReport);
 
-  //! Print renderer extensions.
-  virtual void PrintExtensions();
+  //! Collect renderer limits.
+  virtual void CollectLimits(RendererReport& theReport);
 
-  //! Print renderer limits.
-  virtual void PrintLimits();
+  //! Return names of limits collected by CollectLimits(), like "GL_MAX_TEXTURE_SIZE".
+  static std::vector<std::string> LimitNames();
 
-  //! Print all visuals.
-  virtual void PrintVisuals(bool theIsVerbose) = 0;
+  //! Collect all visuals.
+  //! @param[in] theIsVerbose collect verbose text description of each visual
+  virtual void CollectVisuals(RendererReport& theReport, bool theIsVerbose) = 0;
 
 public:
 
@@ -89,17 +154,30 @@ public:
     return (theFuncPtr != NULL);
   }
 
+  //! Return GL functions of created context.
+  const GlFunctions& Gl() const { return myGl; }
+
   //! glGetError() wrapper.
-  virtual unsigned int GlGetError() = 0;
+  unsigned int GlGetError() { return myGl.glGetError != nullptr ? myGl.glGetError() : 0; }
 
   //! glGetString() wrapper.
-  virtual const char* GlGetString(unsigned int theGlEnum) = 0;
+  const char* GlGetString(unsigned int theGlEnum)
+  {
+    return myGl.glGetString != nullptr ? (const char*)myGl.glGetString(theGlEnum) : nullptr;
+  }
 
   //! glGetStringi() wrapper.
-  virtual const char* GlGetStringi(unsigned int theGlEnum, unsigned int theIndex) = 0;
+  const char* GlGetStringi(unsigned int theGlEnum, unsigned int theIndex)
+  {
+    return myGl.glGetStringi != nullptr ? (const char*)myGl.glGetStringi(theGlEnum, theIndex) : nullptr;
+  }
 
   //! glGetIntegerv() wrapper.
-  virtual void GlGetIntegerv(unsigned int theGlEnum, int* theParams) = 0;
+  void GlGetIntegerv(unsigned int theGlEnum, int* theParams)
+  {
+    if (myGl.glGetIntegerv != nullptr)
+      myGl.glGetIntegerv(theGlEnum, theParams);
+  }
 
 protected:
 
@@ -109,107 +187,47 @@ protected:
 protected:
 
   //! Visual info.
-  struct VisualInfo
-  {
-    int ConfigId = 0;
-
-    enum Caveat
-    {
-      Caveat_None = 0x00,
-      Caveat_Slow = 0x01,
-      Caveat_NonConformant = 0x02
-    };
-    Caveat ConfigCaveat = Caveat_None;
-    bool IsSoftware = false;
-
-    //int RenderbableType;
-
-    enum ColorBuffer
-    {
-      ColorBuffer_ColorIndex,
-      ColorBuffer_Luminance,
-      ColorBuffer_Rgba,
-    };
-    ColorBuffer BufferType = ColorBuffer_Rgba;
-    bool        IsColorFloat = false;
-
-    enum Surface
-    {
-      Surface_None    = 0x00,
-      Surface_Window  = 0x01,
-      Surface_Pixmap  = 0x02,
-      Surface_PBuffer = 0x04,
-      Surface_PBufferRemote = 0x08,
-    };
-    Surface SurfaceType = Surface_None;
-
-    int ColorDepth = 0;
-    int ColorBufferSize = 0;
-    int LuminanceSize = 0;
-    int RedSize = 0;
-    int GreenSize = 0;
-    int BlueSize = 0;
-    int AlphaSize = 0;
-    int DepthSize = 0;
-    int StencilSize = 0;
-
-    int  SwapIntervalMin = 0;
-    int  SwapIntervalMax = 0;
-    bool IsStereoBuffer = false;
-    bool IsSRgb = false;
-
-    int NbAuxBuffers = 0;
-    int AccumRedSize = 0;
-    int AccumGreenSize = 0;
-    int AccumBlueSize = 0;
-    int AccumAlphaSize = 0;
-
-    int NbSampleBuffers = 0;
-    int NbSamples = 0;
-
-    int LayerLevel = 0; // 0 indicates main layer
-    int NbLayersUnderlay = 0;
-    int NbLayersOverlay = 0;
+  typedef RendererReport::VisualInfo VisualInfo;
 
-  public:
-    static void PrintTableHeader(bool theHeader);
-    static void PrintTableSeparator();
+protected:
 
-    void PrintTableLine(bool theIsHexConfigId = true);
+  //! Resolve GL functions of the context made current and reset data cached for previous context;
+  //! should be called by CreateGlContext() right after making context current.
+  //! @param[in] theStatic functions exported by linked GL library, which might be unavailable via GlGetProcAddress()
+  void loadGlFunctions(const GlFunctions& theStatic = GlFunctions())
+  {
+    myGl = theStatic;
+    myGl.Load([this](const char* theName) { return GlGetProcAddress(theName); });
+    myGlExtensions.clear();
+    myHasGlExtensions = false;
+  }
 
+  //! OpenGL version known to be supported by the display,
+  //! used to create a context of the highest version directly instead of descending over versions.
+  struct VersionHint
+  {
+    int Major = 0;
+    int Minor = 0;
+
+    //! Return TRUE if hint defines a version applicable to versioned context creation (3.2+).
+    bool IsValid() const { return Major > 3 || (Major == 3 && Minor >= 2); }
   };
 
-protected:
+  //! Set hint to GL_VERSION of the current context.
+  //! @return FALSE if version cannot be parsed
+  bool updateVersionHint(VersionHint& theHint);
 
   //! Return color buffer class
   static const char* getColorBufferClass(int theNbColorBits, int theNbRedBits);
 
-  //! Format extensions as a comma separated list with line size fixed to 80.
-  static void printExtensions(const char* theExt);
+  //! Return space-separated list of extensions, queried once per context.
+  const std::string& getGlExtensions();
 
-  //! Find extension in the list of extensions.
-  static bool hasExtension(const std::string& theList, const std::string& theName)
-  {
-    std::size_t aPos = theList.find(theName);
-    if (aPos == std::string::npos)
-      return false;
-
-    if (aPos + theName.length() < theList.length()
-     && theList[aPos + theName.length()] != ' ')
-    {
-      return false; // make this is the whole word
-    }
-    return true;
-  }
-
-  //! Return list of extensions.
-  std::string getGlExtensions();
+  //! Collect integer limit.
+  void collectLimitInt(RendererReport& theReport, unsigned int theGlEnum, const char* theName);
 
-  //! Print integer limit.
-  void printLimitInt(unsigned int theGlEnum, const char* theName);
-
-  //! Print integer range limit.
-  void printLimitIntRange(unsigned int theGlEnum, const char* theName);
+  //! Collect integer range limit.
+  void collectLimitIntRange(RendererReport& theReport, unsigned int theGlEnum, const char* theName);
 
   //! Limit definition.
   struct LimitDefinition
@@ -222,14 +240,19 @@ protected:
     : Name(theName), Enum(theEnum), NbVals(theNbVals) {}
   };
 
+  //! Return definitions of collected limits.
+  static const std::vector<LimitDefinition>& limitDefinitions();
+
   //! Auxiliary tool to force software OpenGL context creation
   //! when using Mesa via LIBGL_ALWAYS_SOFTWARE=1 environment.
   class SoftMesaSentry
   {
   public:
     ~SoftMesaSentry() { Reset(); }
+    static bool IsSoftRenderer(const std::string& theVendor, const std::string& theRenderer);
     static bool IsSoftContext(BaseGlContext& theDefCtx);
-    bool Init(BaseGlContext& theDefCtx);
+    bool Init(BaseGlContext& theDefCtx) { return Init(IsSoftContext(theDefCtx)); }
+    bool Init(bool theIsDefaultSoft);
     void Reset();
   private:
     std::string myVendLibName;
@@ -242,7 +265,11 @@ protected:
 
 protected:
 
+  std::shared_ptr<PlatformSession> mySession;
   ContextBits myCtxBits = ContextBits_NONE;
+  GlFunctions myGl; //!< GL functions of created context
+  std::string myGlExtensions;      //!< extensions of created context, queried on demand
+  bool        myHasGlExtensions = false;
 
 };
 
@@ -0,0 +1,264 @@
+// Copyright © Kirill Gavrilov, 2026
+//
+// This code is licensed under MIT license (see LICENSE.txt for details).
+
+#include "BenchmarkRunner.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstring>
+#include <iomanip>
+#include <iostream>
+#include <memory>
+#include <sstream>
+
+#define GL_RENDERER     0x1F01
+#define GL_TIME_ELAPSED 0x88BF
+#define GL_QUERY_RESULT 0x8866
+
+BenchmarkRunner::Stats BenchmarkRunner::Stats::Compute(std::vector<double> theSamples)
+{
+  Stats aStats;
+  if (theSamples.empty())
+    return aStats;
+
+  std::sort(theSamples.begin(), theSamples.end());
+  const auto percentile = [&theSamples](double thePercent) -> double
+  {
+    const double aPos = thePercent * 0.01 * double(theSamples.size() - 1);
+    const size_t aLower = (size_t )aPos;
+    const size_t anUpper = std::min(aLower + 1, theSamples.size() - 1);
+    return theSamples[aLower] + (theSamples[anUpper] - theSamples[aLower]) * (aPos - double(aLower));
+  };
+
+  double aSum = 0.0;
+  for (double aSample : theSamples)
+    aSum += aSample;
+
+  aStats.Min    = theSamples.front();
+  aStats.Max    = theSamples.back();
+  aStats.Mean   = aSum / double(theSamples.size());
+  aStats.Median = percentile(50.0);
+  aStats.P95    = percentile(95.0);
+  aStats.P99    = percentile(99.0);
+
+  double aSqSum = 0.0;
+  for (double aSample : theSamples)
+    aSqSum += (aSample - aStats.Mean) * (aSample - aStats.Mean);
+  aStats.StdDev = std::sqrt(aSqSum / double(theSamples.size()));
+  return aStats;
+}
+
+std::vector<BenchmarkRunner::CaseResult> BenchmarkRunner::Run(BaseGlContext& theCtx,
+                                                              const std::vector<GlBenchmark::Info>& theBenchmarks)
+{
+  // timer queries are core since OpenGL 3.3; OpenGL ES exposes them only via EXT-suffixed functions
+  const GlFunctions& aGl = theCtx.Gl();
+  int aMajor = 0, aMinor = 0;
+  ExtensionSet anExtensions;
+  GlBenchmark::ContextVersion(theCtx, aMajor, aMinor);
+  GlBenchmark::ContextExtensions(theCtx, anExtensions);
+  const bool hasTimerQuery = (theCtx.Bits() & BaseGlContext::ContextBits_GLES) == 0
+                          && (aMajor > 3 || (aMajor == 3 && aMinor >= 3)
+                           || anExtensions.Has("GL_ARB_timer_query")
+                           || anExtensions.Has("GL_EXT_timer_query"))
+                          && aGl.glGenQueries != nullptr
+                          && aGl.glBeginQuery != nullptr
+                          && aGl.glGetQueryObjectui64v != nullptr;
+  if (myOptions.TimerMode == Timer_Query && !hasTimerQuery)
+    std::cerr << "Warning: timer queries are unsupported by " << theCtx.ApiName() << " context, glFinish() is used instead\n";
+
+  // software rasterizers execute deferred commands outside of query range, so that queries report near-zero time
+  const char* aRenderer = theCtx.GlGetString(GL_RENDERER);
+  const bool isSoftRenderer = aRenderer != nullptr
+                           && (strstr(aRenderer, "llvmpipe") != nullptr
+                            || strstr(aRenderer, "softpipe") != nullptr
+                            || strstr(aRenderer, "SwiftShader") != nullptr);
+  myIsQueryTimer = hasTimerQuery
+                && (myOptions.TimerMode == Timer_Query
+                 || (myOptions.TimerMode == Timer_Auto && !isSoftRenderer));
+
+  std::vector<CaseResult> aResults;
+  for (const GlBenchmark::Info& anInfo : theBenchmarks)
+  {
+    std::unique_ptr<GlBenchmark> aBench(anInfo.Create());
+    aBench->SetResolutions(myOptions.Resolutions);
+    std::string aReason;
+    if (!aBench->Init(theCtx, aReason))
+    {
+      CaseResult aResult;
+      aResult.Benchmark = anInfo.Name;
+      aResult.Error = "skipped, " + aReason;
+      aResults.push_back(aResult);
+      continue;
+    }
+
+    for (size_t aCaseIter = 0; aCaseIter < aBench->Cases().size(); ++aCaseIter)
+    {
+      CaseResult aResult;
+      aResult.Benchmark = anInfo.Name;
+      aResult.Case      = aBench->Cases()[aCaseIter].Name;
+      aResult.NbBytes   = aBench->Cases()[aCaseIter].NbBytes;
+      runCase(theCtx, *aBench, aCaseIter, aResult);
+      aResults.push_back(aResult);
+    }
+    aBench->Release();
+  }
+  return aResults;
+}
+
+void BenchmarkRunner::runCase(BaseGlContext& theCtx, GlBenchmark& theBench, size_t theCase, CaseResult& theResult)
+{
+  typedef std::chrono::steady_clock Clock;
+  const GlFunctions& aGl = theCtx.Gl();
+
+  // reset error state left by previous case
+  for (int anErrIter = 0; anErrIter < 16 && theCtx.GlGetError() != 0; ++anErrIter) {}
+
+  if (!theBench.SetupCase(theCase))
+  {
+    theResult.Error = "case setup has failed";
+    theBench.ReleaseCase(theCase);
+    return;
+  }
+
+  // waiting for results of pipelined iterations would defeat pipelining
+  const bool isPipelined = theBench.IsPipelined(theCase);
+  theResult.IsPipelined = isPipelined;
+  unsigned int aQuery = 0;
+  if (myIsQueryTimer && !isPipelined)
+    aGl.glGenQueries(1, &aQuery);
+
+  aGl.glFinish();
+  for (int anIter = 0; anIter < myOptions.NbWarmup && theResult.Error.empty(); ++anIter)
+  {
+    theBench.Iterate(theCase);
+    theResult.Error = theBench.IterationError();
+    if (!isPipelined)
+      aGl.glFinish();
+  }
+
+  std::vector<double> aCpuSamples, aGpuSamples, aLatencySamples;
+  aCpuSamples.reserve(myOptions.NbRepetitions);
+  aGpuSamples.reserve(myOptions.NbRepetitions);
+  const Clock::time_point aLoopStart = Clock::now();
+  for (int anIter = 0; anIter < myOptions.NbRepetitions && theResult.Error.empty(); ++anIter)
+  {
+    const Clock::time_point aStart = Clock::now();
+    if (aQuery != 0)
+      aGl.glBeginQuery(GL_TIME_ELAPSED, aQuery);
+    theBench.Iterate(theCase);
+    theResult.Error = theBench.IterationError();
+    if (aQuery != 0)
+      aGl.glEndQuery(GL_TIME_ELAPSED);
+    const Clock::time_point aSubmitted = Clock::now();
+    if (!isPipelined)
+      aGl.glFinish();
+    const Clock::time_point aFinished = Clock::now();
+
+    aCpuSamples.push_back(std::chrono::duration<double, std::milli>(aSubmitted - aStart).count());
+    if (aQuery != 0)
+    {
+      uint64_t aTimeNs = 0;
+      aGl.glGetQueryObjectui64v(aQuery, GL_QUERY_RESULT, &aTimeNs);
+      aGpuSamples.push_back(double(aTimeNs) * 0.000001);
+    }
+    else
+    {
+      aGpuSamples.push_back(std::chrono::duration<double, std::milli>(aFinished - aStart).count());
+    }
+    if (theBench.LastLatencyMs() >= 0.0)
+      aLatencySamples.push_back(theBench.LastLatencyMs());
+  }
+  if (isPipelined)
+  {
+    // intervals between submissions do not account frames still queued by the driver,
+    // so that throughput is derived from the whole loop including completion of the last frame
+    aGl.glFinish();
+    if (!aGpuSamples.empty())
+      theResult.FrameMs = std::chrono::duration<double, std::milli>(Clock::now() - aLoopStart).count() / double(aGpuSamples.size());
+  }
+
+  const unsigned int anError = theCtx.GlGetError();
+  if (anError != 0 && theResult.Error.empty())
+  {
+    std::ostringstream anErrStream;
+    anErrStream << "GL error 0x" << std::hex << anError;
+    theResult.Error = anErrStream.str();
+  }
+
+  if (aQuery != 0)
+    aGl.glDeleteQueries(1, &aQuery);
+  theBench.ReleaseCase(theCase);
+  theResult.CpuMs = Stats::Compute(aCpuSamples);
+  theResult.GpuMs = Stats::Compute(aGpuSamples);
+  theResult.LatencyMs = Stats::Compute(aLatencySamples);
+  theResult.HasLatency = !aLatencySamples.empty();
+}
+
+void BenchmarkRunner::PrintTable(std::ostream& theStream,
+                                 const std::string& theLabel,
+                                 const std::vector<CaseResult>& theResults) const
+{
+  const std::ios_base::fmtflags anOldFlags = theStream.flags();
+  const std::streamsize anOldPrec = theStream.precision();
+  size_t aNameWidth = 36;
+  bool hasLatency = false, hasPipelined = false;
+  for (const CaseResult& aResult : theResults)
+  {
+    aNameWidth = std::max(aNameWidth, aResult.Benchmark.length() + aResult.Case.length() + 3);
+    hasLatency   = hasLatency   || aResult.HasLatency;
+    hasPipelined = hasPipelined || aResult.IsPipelined;
+  }
+
+  theStream << std::fixed << std::setprecision(3);
+  theStream << "\n" << theLabel << " benchmarks: "
+            << myOptions.NbWarmup << " warmup, " << myOptions.NbRepetitions << " repetitions, GPU time by "
+            << (myIsQueryTimer ? "GL_TIME_ELAPSED queries" : "glFinish()") << "\n"
+            << "  " << std::left << std::setw((int )aNameWidth) << "benchmark" << std::right
+            << std::setw(12) << "cpu med, ms" << std::setw(12) << "gpu med, ms"
+            << std::setw(12) << "gpu p95, ms" << std::setw(12) << "gpu p99, ms" << std::setw(10) << "GB/s";
+  if (hasPipelined)
+    theStream << std::setw(12) << "jitter, ms";
+  if (hasLatency)
+    theStream << std::setw(12) << "lat med, ms" << std::setw(12) << "lat p95, ms";
+  theStream << "\n";
+  for (const CaseResult& aResult : theResults)
+  {
+    std::string aName = aResult.Case.empty() ? aResult.Benchmark : aResult.Benchmark + " " + aResult.Case;
+    if (aResult.IsPipelined)
+      aName += "*";
+    theStream << "  " << std::left << std::setw((int )aNameWidth) << aName << std::right;
+    if (!aResult.Error.empty())
+    {
+      theStream << aResult.Error << "\n";
+      continue;
+    }
+
+    const double aGpuMs = aResult.IsPipelined ? aResult.FrameMs : aResult.GpuMs.Median;
+    theStream << std::setw(12) << aResult.CpuMs.Median << std::setw(12) << aGpuMs;
+    if (aResult.IsPipelined)
+      theStream << std::setw(12) << "-" << std::setw(12) << "-";
+    else
+      theStream << std::setw(12) << aResult.GpuMs.P95 << std::setw(12) << aResult.GpuMs.P99;
+    if (aResult.NbBytes > 0.0 && aGpuMs > 0.0)
+      theStream << std::setw(10) << (aResult.NbBytes / (aGpuMs * 1000000.0));
+    else
+      theStream << std::setw(10) << "-";
+    if (aResult.IsPipelined)
+      theStream << std::setw(12) << aResult.GpuMs.StdDev;
+    else if (hasPipelined)
+      theStream << std::setw(12) << "-";
+    if (aResult.HasLatency)
+      theStream << std::setw(12) << aResult.LatencyMs.Median << std::setw(12) << aResult.LatencyMs.P95;
+    else if (hasLatency)
+      theStream << std::setw(12) << "-" << std::setw(12) << "-";
+    theStream << "\n";
+  }
+  if (hasPipelined)
+    theStream << "  * pipelined case: GPU time is a mean frame time over all repetitions including completion of the last frame,\n"
+                 "    jitter is a standard deviation of intervals between frame submissions\n";
+  theStream.flags(anOldFlags);
+  theStream.precision(anOldPrec);
+}
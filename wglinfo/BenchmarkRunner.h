@@ -0,0 +1,106 @@
+// Copyright © Kirill Gavrilov, 2026
+//
+// This code is licensed under MIT license (see LICENSE.txt for details).
+
+#ifndef BENCHMARKRUNNER_HEADER
+#define BENCHMARKRUNNER_HEADER
+
+#include "GlBenchmark.h"
+
+#include <ostream>
+
+//! Executor of GlBenchmark cases on a context made current.
+//! Each case is executed several warmup iterations followed by measured repetitions.
+//! For every repetition the runner records:
+//! - CPU time - wall time spent within Iterate() submitting commands;
+//! - GPU time - GL_TIME_ELAPSED timer query around submitted commands,
+//!   or wall time till glFinish() returns when timer queries are unavailable.
+//! Pipelined benchmarks are not waited for completion of each iteration,
+//! so that their GPU time is a wall time of iteration (interval between frames).
+class BenchmarkRunner
+{
+public:
+
+  //! GPU time measurement.
+  enum Timer
+  {
+    Timer_Auto,   //!< timer queries when available (except software renderers), glFinish() otherwise
+    Timer_Finish, //!< wall time till glFinish() returns
+    Timer_Query,  //!< GL_TIME_ELAPSED timer queries
+  };
+
+  //! Runner options.
+  struct Options
+  {
+    int   NbWarmup      = 5;  //!< number of warmup iterations per case
+    int   NbRepetitions = 50; //!< number of measured iterations per case
+    Timer TimerMode     = Timer_Auto;
+    std::vector<std::pair<int, int>> Resolutions; //!< framebuffer resolutions; empty means benchmark defaults
+  };
+
+  //! Statistics of measured samples.
+  struct Stats
+  {
+    double Min    = 0.0;
+    double Mean   = 0.0;
+    double Median = 0.0;
+    double P95    = 0.0;
+    double P99    = 0.0;
+    double Max    = 0.0;
+    double StdDev = 0.0;
+
+    //! Compute statistics of samples (percentiles are linearly interpolated).
+    static Stats Compute(std::vector<double> theSamples);
+  };
+
+  //! Result of measured case.
+  struct CaseResult
+  {
+    std::string Benchmark;     //!< benchmark name
+    std::string Case;          //!< case name
+    double      NbBytes = 0.0; //!< bytes transferred per iteration
+    Stats       CpuMs;         //!< submission time in milliseconds
+    Stats       GpuMs;         //!< GPU time in milliseconds (interval between frame submissions for pipelined benchmark)
+    double      FrameMs = 0.0; //!< mean frame time of pipelined benchmark, measured over all repetitions
+                               //!  including completion of the last frame
+    Stats       LatencyMs;     //!< frame latency in milliseconds, if measured by benchmark
+    bool        HasLatency = false;  //!< flag indicating that LatencyMs is defined
+    bool        IsPipelined = false; //!< flag indicating pipelined benchmark
+    std::string Error;         //!< error message, empty if case has been measured
+  };
+
+public:
+
+  //! Empty constructor.
+  BenchmarkRunner() {}
+
+  //! Main constructor.
+  BenchmarkRunner(const Options& theOptions) : myOptions(theOptions) {}
+
+  //! Return options.
+  const Options& RunnerOptions() const { return myOptions; }
+
+  //! Run benchmarks on the context made current.
+  std::vector<CaseResult> Run(BaseGlContext& theCtx, const std::vector<GlBenchmark::Info>& theBenchmarks);
+
+  //! Return TRUE if GPU time has been measured by timer queries within the last Run().
+  bool IsQueryTimer() const { return myIsQueryTimer; }
+
+  //! Print results as a table.
+  void PrintTable(std::ostream& theStream,
+                  const std::string& theLabel,
+                  const std::vector<CaseResult>& theResults) const;
+
+private:
+
+  //! Measure single case.
+  void runCase(BaseGlContext& theCtx, GlBenchmark& theBench, size_t theCase, CaseResult& theResult);
+
+private:
+
+  Options myOptions;
+  bool    myIsQueryTimer = false;
+
+};
+
+#endif // BENCHMARKRUNNER_HEADER
@@ -0,0 +1,75 @@
+// Copyright © Kirill Gavrilov, 2026
+//
+// This code is licensed under MIT license (see LICENSE.txt for details).
+
+#ifndef BINARYDATA_HEADER
+#define BINARYDATA_HEADER
+
+#include <cstdint>
+#include <string>
+
+//! Auxiliary tools for compact binary serialization:
+//! little-endian 32-bit integers and length-prefixed strings.
+class BinaryData
+{
+public:
+
+  //! Append 32-bit integer (little-endian).
+  static void WriteUInt32(std::string& theData, uint32_t theVal)
+  {
+    for (int aByteIter = 0; aByteIter < 4; ++aByteIter)
+      theData.push_back(char((theVal >> (aByteIter * 8)) & 0xFF));
+  }
+
+  //! Append signed 32-bit integer.
+  static void WriteInt32(std::string& theData, int theVal) { WriteUInt32(theData, (uint32_t)theVal); }
+
+  //! Append length-prefixed string.
+  static void WriteString(std::string& theData, const std::string& theStr)
+  {
+    WriteUInt32(theData, (uint32_t)theStr.size());
+    theData.append(theStr);
+  }
+
+  //! Read 32-bit integer (little-endian).
+  static bool ReadUInt32(const std::string& theData, size_t& thePos, uint32_t& theVal)
+  {
+    if (thePos + 4 > theData.size())
+      return false;
+
+    theVal = 0;
+    for (int aByteIter = 0; aByteIter < 4; ++aByteIter)
+      theVal |= uint32_t((unsigned char)theData[thePos + aByteIter]) << (aByteIter * 8);
+    thePos += 4;
+    return true;
+  }
+
+  //! Read signed 32-bit integer.
+  static bool ReadInt32(const std::string& theData, size_t& thePos, int& theVal)
+  {
+    uint32_t aVal = 0;
+    if (!ReadUInt32(theData, thePos, aVal))
+      return false;
+
+    theVal = (int)aVal;
+    return true;
+  }
+
+  //! Read length-prefixed string.
+  static bool ReadString(const std::string& theData, size_t& thePos, std::string& theStr)
+  {
+    uint32_t aLen = 0;
+    if (!ReadUInt32(theData, thePos, aLen)
+     || thePos + aLen > theData.size())
+    {
+      return false;
+    }
+
+    theStr.assign(theData, thePos, aLen);
+    thePos += aLen;
+    return true;
+  }
+
+};
+
+#endif // BINARYDATA_HEADER
@@ -0,0 +1,235 @@
+// Copyright © Kirill Gavrilov, 2026
+//
+// This code is licensed under MIT license (see LICENSE.txt for details).
+
+#include "BufferStreamBenchmark.h"
+
+#include <cstring>
+
+#define GL_ARRAY_BUFFER                     0x8892
+#define GL_COPY_WRITE_BUFFER                0x8F37
+#define GL_STREAM_DRAW                      0x88E0
+#define GL_STATIC_COPY                      0x88E6
+#define GL_UNIFORM_BUFFER_OFFSET_ALIGNMENT  0x8A34
+
+#define GL_MAP_WRITE_BIT                    0x0002
+#define GL_MAP_INVALIDATE_RANGE_BIT         0x0004
+#define GL_MAP_UNSYNCHRONIZED_BIT           0x0020
+#define GL_MAP_PERSISTENT_BIT               0x0040
+#define GL_MAP_COHERENT_BIT                 0x0080
+#define GL_SYNC_GPU_COMMANDS_COMPLETE       0x9117
+#define GL_SYNC_FLUSH_COMMANDS_BIT          0x00000001
+#define GL_TIMEOUT_EXPIRED                  0x911B
+#define GL_WAIT_FAILED                      0x911D
+
+namespace
+{
+  //! Strategy names.
+  static const char* THE_STRATEGY_NAMES[] = { "subdata", "orphan", "map-ring", "persistent" };
+
+  //! Number of ring slots, also limiting the number of frames in flight for every strategy.
+  static const size_t THE_NB_SLOTS = 3;
+
+  //! Fence wait timeout in nanoseconds.
+  static const uint64_t THE_FENCE_TIMEOUT_NS = 1000000000;
+
+  //! Return size as a short string like "4KiB" or "64MiB".
+  static std::string formatSize(size_t theSize)
+  {
+    return theSize >= 1024 * 1024
+         ? std::to_string(theSize / (1024 * 1024)) + "MiB"
+         : std::to_string(theSize / 1024) + "KiB";
+  }
+}
+
+bool BufferStreamBenchmark::init(std::string& theReason)
+{
+  // buffer copies are core since OpenGL 3.1 and OpenGL ES 3.0; fences since OpenGL 3.2
+  const GlFunctions& aGl = gl();
+  if (aGl.glGenBuffers == nullptr
+   || aGl.glCopyBufferSubData == nullptr
+   || aGl.glMapBufferRange == nullptr
+   || aGl.glFenceSync == nullptr
+   || aGl.glClientWaitSync == nullptr
+   || (isGles() ? !isGlGreaterEqual(3, 0) : (!isGlGreaterEqual(3, 2) && !hasExtension("GL_ARB_sync"))))
+  {
+    theReason = "buffer copies or fences are unsupported";
+    return false;
+  }
+
+  const bool hasPersist = aGl.glBufferStorage != nullptr
+                       && (isGles() ? hasExtension("GL_EXT_buffer_storage")
+                                    : (isGlGreaterEqual(4, 4) || hasExtension("GL_ARB_buffer_storage")));
+  myAlignment = 1;
+  myCtx->GlGetIntegerv(GL_UNIFORM_BUFFER_OFFSET_ALIGNMENT, &myAlignment);
+  myAlignment = myAlignment > 0 ? myAlignment : 1;
+
+  myStreamCases.clear();
+  for (int aStratIter = Strategy_SubData; aStratIter <= Strategy_Persistent; ++aStratIter)
+  {
+    if (aStratIter == Strategy_Persistent && !hasPersist)
+      continue;
+
+    for (size_t aSize = 4 * 1024; aSize <= 64 * 1024 * 1024; aSize *= 4)
+    {
+      StreamCase aStreamCase;
+      aStreamCase.Strat = (Strategy )aStratIter;
+      aStreamCase.Size  = aSize;
+      myStreamCases.push_back(aStreamCase);
+
+      Case aCase;
+      aCase.Name = std::string(THE_STRATEGY_NAMES[aStratIter]) + " " + formatSize(aSize);
+      aCase.NbBytes = double(aSize);
+      myCases.push_back(aCase);
+    }
+  }
+  return true;
+}
+
+bool BufferStreamBenchmark::SetupCase(size_t theCase)
+{
+  const GlFunctions& aGl = gl();
+  const StreamCase& aStreamCase = myStreamCases[theCase];
+  myData.resize(aStreamCase.Size);
+  for (size_t aByteIter = 0; aByteIter < myData.size(); ++aByteIter)
+    myData[aByteIter] = (unsigned char )(aByteIter * 13 + 5);
+
+  myFrame = 0;
+  myIterError.clear();
+  myFences.assign(THE_NB_SLOTS, nullptr);
+  mySlotSize = (aStreamCase.Size + myAlignment - 1) / myAlignment * myAlignment;
+  const bool isRing = aStreamCase.Strat == Strategy_MapRing
+                   || aStreamCase.Strat == Strategy_Persistent;
+  const size_t aBufferSize = isRing ? mySlotSize * THE_NB_SLOTS : aStreamCase.Size;
+
+  aGl.glGenBuffers(1, &myDstBuffer);
+  aGl.glBindBuffer(GL_COPY_WRITE_BUFFER, myDstBuffer);
+  aGl.glBufferData(GL_COPY_WRITE_BUFFER, (ptrdiff_t )aStreamCase.Size, nullptr, GL_STATIC_COPY);
+  aGl.glBindBuffer(GL_COPY_WRITE_BUFFER, 0);
+
+  aGl.glGenBuffers(1, &myBuffer);
+  aGl.glBindBuffer(GL_ARRAY_BUFFER, myBuffer);
+  if (aStreamCase.Strat == Strategy_Persistent)
+  {
+    aGl.glBufferStorage(GL_ARRAY_BUFFER, (ptrdiff_t )aBufferSize, nullptr,
+                        GL_MAP_WRITE_BIT | GL_MAP_PERSISTENT_BIT | GL_MAP_COHERENT_BIT);
+    myMapped = (unsigned char* )aGl.glMapBufferRange(GL_ARRAY_BUFFER, 0, (ptrdiff_t )aBufferSize,
+                                                     GL_MAP_WRITE_BIT | GL_MAP_PERSISTENT_BIT | GL_MAP_COHERENT_BIT);
+  }
+  else
+  {
+    aGl.glBufferData(GL_ARRAY_BUFFER, (ptrdiff_t )aBufferSize, nullptr, GL_STREAM_DRAW);
+  }
+  aGl.glBindBuffer(GL_ARRAY_BUFFER, 0);
+  if (aStreamCase.Strat == Strategy_Persistent && myMapped == nullptr)
+    return false;
+  return myCtx->GlGetError() == 0;
+}
+
+bool BufferStreamBenchmark::waitSlot(size_t theSlot)
+{
+  const GlFunctions& aGl = gl();
+  if (myFences[theSlot] == nullptr)
+    return true;
+
+  const unsigned int aRes = aGl.glClientWaitSync(myFences[theSlot], GL_SYNC_FLUSH_COMMANDS_BIT, THE_FENCE_TIMEOUT_NS);
+  aGl.glDeleteSync(myFences[theSlot]);
+  myFences[theSlot] = nullptr;
+  if (aRes == GL_TIMEOUT_EXPIRED)
+  {
+    myIterError = "fence wait has timed out";
+    return false;
+  }
+  else if (aRes == GL_WAIT_FAILED)
+  {
+    myIterError = "fence wait has failed";
+    return false;
+  }
+  return true;
+}
+
+void BufferStreamBenchmark::Iterate(size_t theCase)
+{
+  const GlFunctions& aGl = gl();
+  const StreamCase& aStreamCase = myStreamCases[theCase];
+  const ptrdiff_t aSize = (ptrdiff_t )aStreamCase.Size;
+  const size_t aSlot = myFrame++ % THE_NB_SLOTS;
+  ptrdiff_t anOffset = 0;
+
+  // every strategy keeps at most THE_NB_SLOTS frames in flight, so that frame time measures
+  // throughput of consumed frames rather than the rate of commands queued by the driver;
+  // ring slot could be overwritten only after GPU has consumed it THE_NB_SLOTS frames ago
+  if (!waitSlot(aSlot))
+    return;
+
+  aGl.glBindBuffer(GL_ARRAY_BUFFER, myBuffer);
+  switch (aStreamCase.Strat)
+  {
+    case Strategy_SubData:
+    {
+      aGl.glBufferSubData(GL_ARRAY_BUFFER, 0, aSize, myData.data());
+      break;
+    }
+    case Strategy_Orphan:
+    {
+      aGl.glBufferData(GL_ARRAY_BUFFER, aSize, nullptr, GL_STREAM_DRAW);
+      aGl.glBufferSubData(GL_ARRAY_BUFFER, 0, aSize, myData.data());
+      break;
+    }
+    case Strategy_MapRing:
+    case Strategy_Persistent:
+    {
+      anOffset = (ptrdiff_t )(aSlot * mySlotSize);
+      if (aStreamCase.Strat == Strategy_Persistent)
+      {
+        memcpy(myMapped + anOffset, myData.data(), myData.size());
+      }
+      else if (void* aMapped = aGl.glMapBufferRange(GL_ARRAY_BUFFER, anOffset, aSize,
+                                                    GL_MAP_WRITE_BIT | GL_MAP_INVALIDATE_RANGE_BIT | GL_MAP_UNSYNCHRONIZED_BIT))
+      {
+        memcpy(aMapped, myData.data(), myData.size());
+        aGl.glUnmapBuffer(GL_ARRAY_BUFFER);
+      }
+      else
+      {
+        aGl.glBindBuffer(GL_ARRAY_BUFFER, 0);
+        myIterError = "glMapBufferRange() has failed";
+        return;
+      }
+      break;
+    }
+  }
+
+  aGl.glBindBuffer(GL_COPY_WRITE_BUFFER, myDstBuffer);
+  aGl.glCopyBufferSubData(GL_ARRAY_BUFFER, GL_COPY_WRITE_BUFFER, anOffset, 0, aSize);
+  aGl.glBindBuffer(GL_COPY_WRITE_BUFFER, 0);
+  aGl.glBindBuffer(GL_ARRAY_BUFFER, 0);
+  myFences[aSlot] = aGl.glFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0);
+  aGl.glFlush();
+}
+
+void BufferStreamBenchmark::ReleaseCase(size_t )
+{
+  const GlFunctions& aGl = gl();
+  for (void*& aFence : myFences)
+  {
+    if (aFence != nullptr)
+      aGl.glDeleteSync(aFence);
+    aFence = nullptr;
+  }
+  if (myMapped != nullptr)
+  {
+    aGl.glBindBuffer(GL_ARRAY_BUFFER, myBuffer);
+    aGl.glUnmapBuffer(GL_ARRAY_BUFFER);
+    aGl.glBindBuffer(GL_ARRAY_BUFFER, 0);
+    myMapped = nullptr;
+  }
+  if (myBuffer != 0)
+    aGl.glDeleteBuffers(1, &myBuffer);
+  if (myDstBuffer != 0)
+    aGl.glDeleteBuffers(1, &myDstBuffer);
+  myBuffer = 0;
+  myDstBuffer = 0;
+  myData.clear();
+  myData.shrink_to_fit();
+}
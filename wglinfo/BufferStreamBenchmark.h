@@ -0,0 +1,84 @@
+// Copyright © Kirill Gavrilov, 2026
+//
+// This code is licensed under MIT license (see LICENSE.txt for details).
+
+#ifndef BUFFERSTREAMBENCHMARK_HEADER
+#define BUFFERSTREAMBENCHMARK_HEADER
+
+#include "GlBenchmark.h"
+
+//! Benchmark of per-frame buffer streaming strategies ("buf-stream").
+//! Each iteration (frame) writes a block of data of the case size into a buffer object
+//! and lets GPU consume it by glCopyBufferSubData() into another buffer:
+//! - "subdata"    - glBufferSubData() into the same buffer;
+//! - "orphan"     - glBufferData(NULL) orphaning followed by glBufferSubData();
+//! - "map-ring"   - glMapBufferRange() with GL_MAP_INVALIDATE_RANGE_BIT | GL_MAP_UNSYNCHRONIZED_BIT
+//!                  into a ring of slots guarded by fences;
+//! - "persistent" - persistently and coherently mapped ring (GL_ARB_buffer_storage) guarded by fences.
+//! Ring slots are aligned to GL_UNIFORM_BUFFER_OFFSET_ALIGNMENT, so that they could be bound as uniform blocks.
+//! Iterations are pipelined - frame time and its jitter are measured without waiting for each frame,
+//! but every strategy waits for the fence of the frame submitted 3 frames ago (the ring size).
+//! Failed fence wait or buffer mapping stops the case with an error.
+class BufferStreamBenchmark : public GlBenchmark
+{
+public:
+
+  //! Streaming strategy.
+  enum Strategy
+  {
+    Strategy_SubData,    //!< glBufferSubData()
+    Strategy_Orphan,     //!< glBufferData() orphaning
+    Strategy_MapRing,    //!< unsynchronized glMapBufferRange() ring
+    Strategy_Persistent, //!< persistent coherent mapping ring
+  };
+
+public:
+
+  //! Empty constructor.
+  BufferStreamBenchmark() {}
+
+  //! All cases are pipelined.
+  virtual bool IsPipelined(size_t ) const override { return true; }
+
+  //! Allocate buffers of the case.
+  virtual bool SetupCase(size_t theCase) override;
+
+  //! Stream a single frame.
+  virtual void Iterate(size_t theCase) override;
+
+  //! Release buffers of the case.
+  virtual void ReleaseCase(size_t theCase) override;
+
+protected:
+
+  //! Define cases for strategies supported by context.
+  virtual bool init(std::string& theReason) override;
+
+private:
+
+  //! Wait for the fence of the frame previously written into the slot.
+  //! @return FALSE if wait has failed or timed out
+  bool waitSlot(size_t theSlot);
+
+  //! Internal case definition.
+  struct StreamCase
+  {
+    Strategy Strat = Strategy_SubData;
+    size_t   Size = 0;
+  };
+
+private:
+
+  std::vector<StreamCase>    myStreamCases;       //!< definition of each case
+  std::vector<unsigned char> myData;              //!< source data in client memory
+  std::vector<void*>         myFences;            //!< fences of frames in flight per slot, NULL for free slot
+  unsigned int               myBuffer = 0;        //!< streamed buffer
+  unsigned int               myDstBuffer = 0;     //!< buffer consuming streamed data
+  unsigned char*             myMapped = nullptr;  //!< persistently mapped ring
+  size_t                     mySlotSize = 0;      //!< aligned size of ring slot
+  size_t                     myFrame = 0;         //!< frame counter
+  int                        myAlignment = 1;     //!< GL_UNIFORM_BUFFER_OFFSET_ALIGNMENT
+
+};
+
+#endif // BUFFERSTREAMBENCHMARK_HEADER
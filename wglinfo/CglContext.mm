@@ -28,6 +28,7 @@
 #include <map>
 #include <memory>
 #include <set>
+#include <sstream>
 #include <vector>
 
 #if defined(__GNUC__) && !defined(__INTEL_COMPILER) && !defined(__clang__)
@@ -120,6 +121,7 @@ bool CglContext::CreateGlContext(ContextBits theBits)
     return false;
   }
 
+  loadGlFunctions();
   return true;
 }
 
@@ -137,45 +139,16 @@ void* CglContext::GlGetProcAddress(const char* theFuncName)
   return (myGlLibHandle != nullptr) ? dlsym(myGlLibHandle, theFuncName) : nullptr;
 }
 
-unsigned int CglContext::GlGetError()
+void CglContext::CollectPlatformInfo(RendererReport& theReport, bool theToCollectExtensions)
 {
-  return ::glGetError();
+  theReport.Sections |= RendererReport::Section_Platform;
+  theReport.AddPlatformProperty("CGLName", "OpenGL.framework");
+  (void)theToCollectExtensions;
 }
 
-const char* CglContext::GlGetString(unsigned int theGlEnum)
+void CglContext::CollectGpuMemoryInfo(RendererReport& theReport)
 {
-  const char* aStr = (const char*)::glGetString(theGlEnum);
-  if (aStr == nullptr)
-  {
-    //
-  }
-  return aStr;
-}
-
-const char* CglContext::GlGetStringi(unsigned int theGlEnum, unsigned int theIndex)
-{
-  typedef const GLubyte* (*glGetStringi_t) (GLenum name, GLuint index);
-  glGetStringi_t aGetStringi = NULL;
-  if (!FindProc("glGetStringi", aGetStringi))
-    return NULL;
-
-  return (const char*)aGetStringi(theGlEnum, theIndex);
-}
-
-void CglContext::GlGetIntegerv(unsigned int theGlEnum, int* theParams)
-{
-  ::glGetIntegerv(theGlEnum, theParams);
-}
-
-void CglContext::PrintPlatformInfo(bool theToPrintExtensions)
-{
-  std::cout << "[" << PlatformName() << "] CGLName: OpenGL.framework\n";
-  (void)theToPrintExtensions;
-}
-
-void CglContext::PrintGpuMemoryInfo()
-{
-  BaseGlContext::PrintGpuMemoryInfo();
+  BaseGlContext::CollectGpuMemoryInfo(theReport);
 
   GLint aGlRendId = 0;
   CGLGetParameter(CGLGetCurrentContext(), kCGLCPCurrentRendererID, &aGlRendId);
@@ -198,16 +171,24 @@ void CglContext::PrintGpuMemoryInfo()
     GLint aVMem = 0, aVTMem = 0;
   #if MAC_OS_X_VERSION_MIN_REQUIRED >= 1070
     if (CGLDescribeRenderer(aRendObj, aRendIter, kCGLRPVideoMemoryMegabytes, &aVMem) == kCGLNoError && aVMem != 0)
-      std::cout << Prefix() << "GPU memory: " << aVMem << " MiB\n";
+    {
+      theReport.AddGpuMemory("videoMiB", "GPU memory", (int)aVMem);
+    }
 
     if (CGLDescribeRenderer(aRendObj, aRendIter, kCGLRPTextureMemoryMegabytes, &aVTMem) == kCGLNoError && aVTMem != aVMem)
-      std::cout << Prefix() << "GPU texture memory: " << aVTMem << " MiB\n";
+    {
+      theReport.AddGpuMemory("textureMiB", "GPU texture memory", (int)aVTMem);
+    }
   #else
     if (CGLDescribeRenderer(aRendObj, aRendIter, kCGLRPVideoMemory, &aVMem) == kCGLNoError && aVMem != 0)
-      std::cout << Prefix() << "GPU memory: " << (aVMem / (1024 * 1024)) << " MiB\n";
+    {
+      theReport.AddGpuMemory("videoMiB", "GPU memory", (int)(aVMem / (1024 * 1024)));
+    }
 
     if (CGLDescribeRenderer(aRendObj, aRendIter, kCGLRPTextureMemory, &aVTMem) == kCGLNoError && aVTMem != aVMem)
-      std::cout << Prefix() << "GPU texture memory: " << (aVTMem / (1024 * 1024)) << " MiB\n";
+    {
+      theReport.AddGpuMemory("textureMiB", "GPU texture memory", (int)(aVTMem / (1024 * 1024)));
+    }
   #endif
   }
 }
@@ -261,7 +242,7 @@ static const CglContextPixelAttr ThePixelAttributes[] =
 //{ kCGLPFARobust,         "Robust" },
 };
 
-void CglContext::PrintVisuals(bool theIsVerbose)
+void CglContext::CollectVisuals(RendererReport& theReport, bool theIsVerbose)
 {
   // there is no way to enumeration all formats;
   // instead - try calling CGLChoosePixelFormat() with different arguments,
@@ -390,9 +371,10 @@ void CglContext::PrintVisuals(bool theIsVerbose)
     }
   }
 
-  std::cout << "\n[" << PlatformName() << "] " << aFormats.size() << " CGL Visuals\n";
-  if (!theIsVerbose)
-    VisualInfo::PrintTableHeader(true);
+  theReport.Sections |= RendererReport::Section_Visuals;
+  theReport.VisualsTitle = std::to_string(aFormats.size()) + " CGL Visuals";
+  theReport.IsHexConfigId = false;
+  theReport.IsVerboseVisuals = theIsVerbose;
 
   int aFormatIndex = 0;
   for (const FormatInfo& aFormatIter : aFormats)
@@ -408,61 +390,63 @@ void CglContext::PrintVisuals(bool theIsVerbose)
     const int anAlphaSize = getAttrib(kCGLPFAAlphaSize);
     const int aRedBits    = (aColorSize - anAlphaSize) / 3;
 
+    VisualInfo anInfo;
+    anInfo.ConfigId = aFormatIndex;
+    /// TODO anInfo.LayerLevel = aPixIter
+    /// anInfo.NbLayersOverlay = aNbPixs
+
+    anInfo.ConfigCaveat = VisualInfo::Caveat_None;
+    anInfo.IsSoftware = getAttrib(kCGLPFAAccelerated) == 0;
+    anInfo.BufferType = VisualInfo::ColorBuffer_Rgba;
+
+    if (getAttrib(kCGLPFAWindow) != 0)
+      anInfo.SurfaceType = VisualInfo::Surface(anInfo.SurfaceType | VisualInfo::Surface_Window);
+    if (getAttrib(kCGLPFAPBuffer) != 0)
+      anInfo.SurfaceType = VisualInfo::Surface(anInfo.SurfaceType | VisualInfo::Surface_PBuffer);
+    if (getAttrib(kCGLPFARemotePBuffer) != 0)
+      anInfo.SurfaceType = VisualInfo::Surface(anInfo.SurfaceType | VisualInfo::Surface_PBufferRemote);
+
+    anInfo.ColorDepth      = 0;
+    anInfo.ColorBufferSize = aColorSize;
+    anInfo.RedSize         = aRedBits;
+    anInfo.GreenSize       = aRedBits;
+    anInfo.BlueSize        = aRedBits;
+    anInfo.AlphaSize       = anAlphaSize;
+    anInfo.DepthSize       = getAttrib(kCGLPFADepthSize);
+    anInfo.StencilSize     = getAttrib(kCGLPFAStencilSize);
+
+    anInfo.SwapIntervalMin = 0;
+    anInfo.SwapIntervalMax = 0;
+    if (getAttrib(kCGLPFATripleBuffer) != 0)
+      anInfo.SwapIntervalMax = 2;
+    else if (getAttrib(kCGLPFADoubleBuffer) != 0)
+      anInfo.SwapIntervalMax = 1;
+
+    anInfo.IsStereoBuffer = getAttrib(kCGLPFAStereo) != 0;
+    anInfo.IsColorFloat = getAttrib(kCGLPFAColorFloat) != 0;
+    // probably the property is meaningless, as colorspace is assigned to window dynamically
+    // [NSWindow setColorSpace: [NSColorSpace sRGBColorSpace]];
+    anInfo.IsSRgb = !anInfo.IsColorFloat;
+
+    // dummy
+    anInfo.NbAuxBuffers   = getAttrib(kCGLPFAAuxBuffers);
+    anInfo.AccumRedSize   = getAttrib(kCGLPFAAccumSize) / 4;
+    anInfo.AccumGreenSize = getAttrib(kCGLPFAAccumSize) / 4;
+    anInfo.AccumBlueSize  = getAttrib(kCGLPFAAccumSize) / 4;
+    anInfo.AccumAlphaSize = getAttrib(kCGLPFAAccumSize) / 4;
+
+    anInfo.NbSampleBuffers = getAttrib(kCGLPFASampleBuffers);
+    anInfo.NbSamples       = getAttrib(kCGLPFASamples);
+
+    theReport.Visuals.push_back(anInfo);
     if (!theIsVerbose)
     {
-      VisualInfo anInfo;
-      anInfo.ConfigId = aFormatIndex++;
-      /// TODO anInfo.LayerLevel = aPixIter
-      /// anInfo.NbLayersOverlay = aNbPixs
-
-      anInfo.ConfigCaveat = VisualInfo::Caveat_None;
-	  anInfo.IsSoftware = getAttrib(kCGLPFAAccelerated) == 0;
-      anInfo.BufferType = VisualInfo::ColorBuffer_Rgba;
-
-      if (getAttrib(kCGLPFAWindow) != 0)
-        anInfo.SurfaceType = VisualInfo::Surface(anInfo.SurfaceType | VisualInfo::Surface_Window);
-      if (getAttrib(kCGLPFAPBuffer) != 0)
-        anInfo.SurfaceType = VisualInfo::Surface(anInfo.SurfaceType | VisualInfo::Surface_PBuffer);
-      if (getAttrib(kCGLPFARemotePBuffer) != 0)
-        anInfo.SurfaceType = VisualInfo::Surface(anInfo.SurfaceType | VisualInfo::Surface_PBufferRemote);
-
-      anInfo.ColorDepth      = 0;
-      anInfo.ColorBufferSize = aColorSize;
-      anInfo.RedSize         = aRedBits;
-      anInfo.GreenSize       = aRedBits;
-      anInfo.BlueSize        = aRedBits;
-      anInfo.AlphaSize       = anAlphaSize;
-      anInfo.DepthSize       = getAttrib(kCGLPFADepthSize);
-      anInfo.StencilSize     = getAttrib(kCGLPFAStencilSize);
-
-      anInfo.SwapIntervalMin = 0;
-	  anInfo.SwapIntervalMax = 0;
-      if (getAttrib(kCGLPFATripleBuffer) != 0)
-        anInfo.SwapIntervalMax = 2;
-      else if (getAttrib(kCGLPFADoubleBuffer) != 0)
-        anInfo.SwapIntervalMax = 1;
-
-      anInfo.IsStereoBuffer = getAttrib(kCGLPFAStereo) != 0;
-      anInfo.IsColorFloat = getAttrib(kCGLPFAColorFloat) != 0;
-      // probably the property is meaningless, as colorspace is assigned to window dynamically
-      // [NSWindow setColorSpace: [NSColorSpace sRGBColorSpace]];
-      anInfo.IsSRgb = !anInfo.IsColorFloat;
-
-      // dummy
-      anInfo.NbAuxBuffers   = getAttrib(kCGLPFAAuxBuffers);
-      anInfo.AccumRedSize   = getAttrib(kCGLPFAAccumSize) / 4;
-      anInfo.AccumGreenSize = getAttrib(kCGLPFAAccumSize) / 4;
-      anInfo.AccumBlueSize  = getAttrib(kCGLPFAAccumSize) / 4;
-      anInfo.AccumAlphaSize = getAttrib(kCGLPFAAccumSize) / 4;
-
-      anInfo.NbSampleBuffers = getAttrib(kCGLPFASampleBuffers);
-      anInfo.NbSamples       = getAttrib(kCGLPFASamples);
-
-      anInfo.PrintTableLine(false);
+      ++aFormatIndex;
       continue;
     }
 
-    std::cout << "Visual ID: " << aFormatIndex << "\n";
+    std::stringstream aDetails;
+    aDetails << "Visual ID: " << aFormatIndex << "\n";
 
     std::string aRendTarget;
     if (getAttrib(kCGLPFAWindow) != 0)
@@ -479,7 +463,7 @@ void CglContext::PrintVisuals(bool theIsVerbose)
     else
       aRendTarget = ".";
 
-    std::cout << "    color: R" << aRedBits << "G" << aRedBits << "B" << aRedBits << "A" << anAlphaSize
+    aDetails << "    color: R" << aRedBits << "G" << aRedBits << "B" << aRedBits << "A" << anAlphaSize
               << " (" << getColorBufferClass(aColorSize, aRedBits) << ", " << aColorSize << ")"
               << " depth: " << getAttrib(kCGLPFADepthSize) << " stencil: " << getAttrib(kCGLPFAStencilSize) << "\n"
               << "    doubleBuffer: " << (getAttrib(kCGLPFADoubleBuffer) != 0)
@@ -518,44 +502,41 @@ void CglContext::PrintVisuals(bool theIsVerbose)
         continue; // displayed on top using special format
       }
 
-      std::cout << "    " << anAttrIter.Name << ": ";
+      aDetails << "    " << anAttrIter.Name << ": ";
 
       if (anAttrIter.Enum == kCGLPFAOpenGLProfile)
       {
         switch (aVal->second)
         {
-          case kCGLOGLPVersion_Legacy:   std::cout << "Legacy"; break;
-          case kCGLOGLPVersion_3_2_Core: std::cout << "Core3";  break;
-          case kCGLOGLPVersion_GL4_Core: std::cout << "Core4";  break;
-          default: std::cout << aVal->second; break;
+          case kCGLOGLPVersion_Legacy:   aDetails << "Legacy"; break;
+          case kCGLOGLPVersion_3_2_Core: aDetails << "Core3";  break;
+          case kCGLOGLPVersion_GL4_Core: aDetails << "Core4";  break;
+          default: aDetails << aVal->second; break;
         }
       }
       else if (anAttrIter.Enum == kCGLPFARendererID)
       {
         const GLint aMasked = aVal->second & kCGLRendererIDMatchingMask;
-        std::cout <<   "0x" << std::hex << aVal->second << std::dec
+        aDetails <<   "0x" << std::hex << aVal->second << std::dec
                   << " [0x" << std::hex << aMasked << std::dec << "]";
         switch (aMasked)
         {
-          case kCGLRendererGenericFloatID: std::cout << " [GenericFloat]"; break;
-          case kCGLRendererGeForce8xxxID:  std::cout << " [GeForce8]"; break;
-          case kCGLRendererGeForceID:      std::cout << " [GeForce6]"; break;
-          case 0x27f00: std::cout << " [AppleM]"; break;
+          case kCGLRendererGenericFloatID: aDetails << " [GenericFloat]"; break;
+          case kCGLRendererGeForce8xxxID:  aDetails << " [GeForce8]"; break;
+          case kCGLRendererGeForceID:      aDetails << " [GeForce6]"; break;
+          case 0x27f00: aDetails << " [AppleM]"; break;
           default: break;
         }
       }
       else
       {
-        std::cout << aVal->second;
+        aDetails << aVal->second;
       }
-      std::cout << "\n";
+      aDetails << "\n";
     }
+    theReport.VisualDetails.push_back(aDetails.str());
     ++aFormatIndex;
   }
-
-  // table footer
-  if (!theIsVerbose)
-    VisualInfo::PrintTableHeader(false);
 }
 
 #endif
@@ -0,0 +1,95 @@
+// Copyright © Kirill Gavrilov, 2026
+//
+// This code is licensed under MIT license (see LICENSE.txt for details).
+
+#include "ClearBenchmark.h"
+
+#define GL_MAX_TEXTURE_SIZE      0x0D33
+#define GL_TEXTURE_2D            0x0DE1
+#define GL_TEXTURE_MIN_FILTER    0x2801
+#define GL_NEAREST               0x2600
+#define GL_RGBA                  0x1908
+#define GL_RGBA8                 0x8058
+#define GL_UNSIGNED_BYTE         0x1401
+#define GL_COLOR_BUFFER_BIT      0x00004000
+#define GL_FRAMEBUFFER           0x8D40
+#define GL_COLOR_ATTACHMENT0     0x8CE0
+#define GL_FRAMEBUFFER_COMPLETE  0x8CD5
+
+bool ClearBenchmark::init(std::string& theReason)
+{
+  const GlFunctions& aGl = gl();
+  if (aGl.glGenFramebuffers == nullptr
+   || aGl.glGenTextures == nullptr
+   || aGl.glClear == nullptr
+   || (!isGles() && !isGlGreaterEqual(3, 0) && !hasExtension("GL_ARB_framebuffer_object")))
+  {
+    theReason = "framebuffer objects are unsupported";
+    return false;
+  }
+
+  int aMaxSize = 0;
+  mySizes.clear();
+  myCtx->GlGetIntegerv(GL_MAX_TEXTURE_SIZE, &aMaxSize);
+  std::vector<std::pair<int, int>> aResolutions = myResolutions;
+  if (aResolutions.empty())
+  {
+    static const int THE_SIZES[] = { 256, 1024, 2048 };
+    for (int aSize : THE_SIZES)
+      aResolutions.push_back(std::make_pair(aSize, aSize));
+  }
+
+  for (const std::pair<int, int>& aRes : aResolutions)
+  {
+    if (aRes.first > aMaxSize || aRes.second > aMaxSize)
+      continue;
+
+    Case aCase;
+    aCase.Name = std::to_string(aRes.first) + "x" + std::to_string(aRes.second);
+    aCase.NbBytes = double(aRes.first) * double(aRes.second) * 4.0;
+    myCases.push_back(aCase);
+    mySizes.push_back(aRes);
+  }
+  return true;
+}
+
+bool ClearBenchmark::SetupCase(size_t theCase)
+{
+  const GlFunctions& aGl = gl();
+  const std::pair<int, int>& aSize = mySizes[theCase];
+
+  // OpenGL ES 2.0 doesn't accept sized internal formats
+  const int anInternalFormat = isGles() && !isGlGreaterEqual(3, 0) ? GL_RGBA : GL_RGBA8;
+  aGl.glGenTextures(1, &myTexture);
+  aGl.glBindTexture(GL_TEXTURE_2D, myTexture);
+  aGl.glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_NEAREST);
+  aGl.glTexImage2D(GL_TEXTURE_2D, 0, anInternalFormat, aSize.first, aSize.second, 0, GL_RGBA, GL_UNSIGNED_BYTE, nullptr);
+  aGl.glBindTexture(GL_TEXTURE_2D, 0);
+
+  aGl.glGenFramebuffers(1, &myFbo);
+  aGl.glBindFramebuffer(GL_FRAMEBUFFER, myFbo);
+  aGl.glFramebufferTexture2D(GL_FRAMEBUFFER, GL_COLOR_ATTACHMENT0, GL_TEXTURE_2D, myTexture, 0);
+  if (aGl.glCheckFramebufferStatus(GL_FRAMEBUFFER) != GL_FRAMEBUFFER_COMPLETE)
+    return false;
+
+  aGl.glViewport(0, 0, aSize.first, aSize.second);
+  return true;
+}
+
+void ClearBenchmark::Iterate(size_t )
+{
+  const GlFunctions& aGl = gl();
+  const float aColor = (++myFrame % 2) != 0 ? 1.0f : 0.0f;
+  aGl.glClearColor(aColor, 0.5f, 1.0f - aColor, 1.0f);
+  aGl.glClear(GL_COLOR_BUFFER_BIT);
+}
+
+void ClearBenchmark::ReleaseCase(size_t )
+{
+  const GlFunctions& aGl = gl();
+  aGl.glBindFramebuffer(GL_FRAMEBUFFER, 0);
+  aGl.glDeleteFramebuffers(1, &myFbo);
+  aGl.glDeleteTextures(1, &myTexture);
+  myFbo = 0;
+  myTexture = 0;
+}
@@ -0,0 +1,42 @@
+// Copyright © Kirill Gavrilov, 2026
+//
+// This code is licensed under MIT license (see LICENSE.txt for details).
+
+#ifndef CLEARBENCHMARK_HEADER
+#define CLEARBENCHMARK_HEADER
+
+#include "GlBenchmark.h"
+
+//! Benchmark clearing RGBA8 framebuffer object of several sizes ("fbo-clear").
+//! The simplest workload measuring fill rate and per-iteration overhead of the harness itself.
+class ClearBenchmark : public GlBenchmark
+{
+public:
+
+  //! Empty constructor.
+  ClearBenchmark() {}
+
+  //! Create framebuffer of the case size.
+  virtual bool SetupCase(size_t theCase) override;
+
+  //! Clear framebuffer.
+  virtual void Iterate(size_t theCase) override;
+
+  //! Release framebuffer.
+  virtual void ReleaseCase(size_t theCase) override;
+
+protected:
+
+  //! Define cases for resolutions within GL_MAX_TEXTURE_SIZE.
+  virtual bool init(std::string& theReason) override;
+
+private:
+
+  std::vector<std::pair<int, int>> mySizes; //!< framebuffer size of each case
+  unsigned int myFbo = 0;     //!< framebuffer object
+  unsigned int myTexture = 0; //!< color attachment
+  int          myFrame = 0;   //!< iteration counter alternating clear color
+
+};
+
+#endif // CLEARBENCHMARK_HEADER
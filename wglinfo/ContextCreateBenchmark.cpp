@@ -0,0 +1,189 @@
+// Copyright © Kirill Gavrilov, 2026
+//
+// This code is licensed under MIT license (see LICENSE.txt for details).
+
+#include "ContextCreateBenchmark.h"
+
+#include "ProbeTimings.h"
+
+#include <algorithm>
+#include <iomanip>
+
+const char* ContextCreateBenchmark::PhaseName(Phase thePhase)
+{
+  switch (thePhase)
+  {
+    case Phase_Display:     return "display open";
+    case Phase_Config:      return "config choice";
+    case Phase_Context:     return "context create";
+    case Phase_MakeCurrent: return "first MakeCurrent";
+    case Phase_Release:     return "release";
+    case Phase_Total:       return "total";
+  }
+  return "";
+}
+
+ContextCreateBenchmark::Phase ContextCreateBenchmark::PhaseOf(const std::string& theSpan)
+{
+  // spans might have GL version suffix like "eglCreateContext 4.5"
+  const std::string aName = theSpan.substr(0, theSpan.find(' '));
+  if (aName == "BaseWindow::Create"
+   || aName == "eglGetDisplay"
+   || aName == "eglGetPlatformDisplay"
+   || aName == "eglInitialize")
+  {
+    return Phase_Display;
+  }
+  else if (aName == "eglChooseConfig"
+        || aName == "glXChooseFBConfig")
+  {
+    return Phase_Config;
+  }
+  else if (aName == "eglCreateContext"
+        || aName == "eglCreateWindowSurface"
+        || aName == "eglCreatePbufferSurface"
+        || aName == "glXCreateContext"
+        || aName == "glXCreateContextAttribsARB")
+  {
+    return Phase_Context;
+  }
+  else if (aName == "MakeCurrent")
+  {
+    return Phase_MakeCurrent;
+  }
+  return Phase_Total;
+}
+
+bool ContextCreateBenchmark::runCycle(RendererProbe::Platform thePlatform,
+                                      const RendererProbe::Options& theOptions,
+                                      BaseGlContext::ContextBits theBits,
+                                      double thePhases[Phase_NB],
+                                      std::string& thePlatformName)
+{
+  typedef std::chrono::steady_clock Clock;
+  for (int aPhaseIter = 0; aPhaseIter < Phase_NB; ++aPhaseIter)
+    thePhases[aPhaseIter] = 0.0;
+
+  const size_t aFirstSpan = ProbeTimings::Phases().size();
+  const Clock::time_point aStart = Clock::now();
+  bool isCreated = false;
+  {
+    RendererProbe aProbe(thePlatform, theOptions);
+    std::shared_ptr<BaseGlContext> aCtx = aProbe.CreateContext(theBits);
+    isCreated = aCtx.get() != nullptr;
+    if (isCreated)
+      thePlatformName = aCtx->PlatformName();
+
+    const Clock::time_point aReleaseStart = Clock::now();
+    aCtx.reset();
+    aProbe.Release();
+    thePhases[Phase_Release] = std::chrono::duration<double, std::milli>(Clock::now() - aReleaseStart).count();
+  }
+  thePhases[Phase_Total] = std::chrono::duration<double, std::milli>(Clock::now() - aStart).count();
+
+  const std::vector<ProbeTimings::Phase>& aSpans = ProbeTimings::Phases();
+  for (size_t aSpanIter = aFirstSpan; aSpanIter < aSpans.size(); ++aSpanIter)
+  {
+    const Phase aPhase = PhaseOf(aSpans[aSpanIter].Name);
+    if (aPhase != Phase_Total)
+      thePhases[aPhase] += aSpans[aSpanIter].WallMs;
+  }
+  return isCreated;
+}
+
+std::vector<ContextCreateBenchmark::Result> ContextCreateBenchmark::Run(RendererProbe::Platform thePlatform,
+                                                                        const RendererProbe::Options& theOptions)
+{
+  // phases are split using spans collected by ProbeTimings;
+  // spans are dropped afterwards unless collection has been requested by user
+  const bool wasEnabled = ProbeTimings::IsEnabled();
+  const size_t aNbSpans = ProbeTimings::Phases().size();
+  ProbeTimings::SetEnabled(true);
+
+  std::vector<Result> aResults;
+  for (BaseGlContext::ContextBits aBits : theOptions.Profiles)
+  {
+    if (!RendererProbe::IsProfileSupported(thePlatform, aBits))
+      continue;
+
+    Result aResult;
+    std::string aPlatformName;
+    double aPhases[Phase_NB];
+    if (!runCycle(thePlatform, theOptions, aBits, aPhases, aPlatformName))
+      continue;
+
+    aResult.Label = BaseGlContext::ProbeLabel(aPlatformName.c_str(), aBits);
+    for (int aCycleIter = 1; aCycleIter < myOptions.NbWarmup; ++aCycleIter)
+      runCycle(thePlatform, theOptions, aBits, aPhases, aPlatformName);
+
+    for (int aCycleIter = 0; aCycleIter < myOptions.NbRepetitions; ++aCycleIter)
+    {
+      if (!runCycle(thePlatform, theOptions, aBits, aPhases, aPlatformName))
+      {
+        ++aResult.NbFailures;
+        continue;
+      }
+
+      for (int aPhaseIter = 0; aPhaseIter < Phase_NB; ++aPhaseIter)
+        aResult.Samples[aPhaseIter].push_back(aPhases[aPhaseIter]);
+    }
+
+    aResults.push_back(aResult);
+    if (theOptions.IsFirstOnly)
+      break;
+  }
+
+  ProbeTimings::SetEnabled(wasEnabled);
+  if (!wasEnabled)
+    ProbeTimings::Truncate(aNbSpans);
+  return aResults;
+}
+
+void ContextCreateBenchmark::PrintHistogram(std::ostream& theStream, const Result& theResult) const
+{
+  const std::ios_base::fmtflags anOldFlags = theStream.flags();
+  const std::streamsize anOldPrec = theStream.precision();
+  theStream << std::fixed << std::setprecision(3);
+  theStream << "\n" << theResult.Label << " " << Name() << ": "
+            << myOptions.NbWarmup << " warmup, " << myOptions.NbRepetitions << " cycles, "
+            << theResult.NbFailures << " failed\n"
+            << "  " << std::left << std::setw(20) << "phase" << std::right
+            << std::setw(12) << "min, ms" << std::setw(12) << "med, ms"
+            << std::setw(12) << "p95, ms" << std::setw(12) << "max, ms" << "\n";
+  for (int aPhaseIter = 0; aPhaseIter < Phase_NB; ++aPhaseIter)
+  {
+    const BenchmarkRunner::Stats aStats = BenchmarkRunner::Stats::Compute(theResult.Samples[aPhaseIter]);
+    theStream << "  " << std::left << std::setw(20) << PhaseName((Phase )aPhaseIter) << std::right
+              << std::setw(12) << aStats.Min << std::setw(12) << aStats.Median
+              << std::setw(12) << aStats.P95 << std::setw(12) << aStats.Max << "\n";
+  }
+
+  // histogram of total latency with equal-width bins between min and max
+  const std::vector<double>& aTotal = theResult.Samples[Phase_Total];
+  if (!aTotal.empty())
+  {
+    static const int THE_NB_BINS = 10;
+    static const int THE_BAR_WIDTH = 40;
+    const double aMin = *std::min_element(aTotal.begin(), aTotal.end());
+    const double aMax = *std::max_element(aTotal.begin(), aTotal.end());
+    const int aNbBins = aMax > aMin ? THE_NB_BINS : 1;
+    const double aBinWidth = aMax > aMin ? (aMax - aMin) / double(aNbBins) : 1.0;
+    std::vector<int> aBins(aNbBins, 0);
+    for (double aSample : aTotal)
+      ++aBins[std::min(int((aSample - aMin) / aBinWidth), aNbBins - 1)];
+
+    const int aMaxCount = *std::max_element(aBins.begin(), aBins.end());
+    theStream << "  total latency histogram:\n";
+    for (int aBinIter = 0; aBinIter < aNbBins; ++aBinIter)
+    {
+      const double aFrom = aMin + aBinWidth * double(aBinIter);
+      const double aTo   = aNbBins > 1 ? aFrom + aBinWidth : aMax;
+      const int aBarLen  = aBins[aBinIter] * THE_BAR_WIDTH / aMaxCount;
+      theStream << "  " << std::setw(10) << aFrom << " - " << std::setw(10) << aTo << " ms |"
+                << std::left << std::setw(THE_BAR_WIDTH) << std::string(aBarLen, '#') << std::right
+                << " " << aBins[aBinIter] << "\n";
+    }
+  }
+  theStream.flags(anOldFlags);
+  theStream.precision(anOldPrec);
+}
@@ -0,0 +1,83 @@
+// Copyright © Kirill Gavrilov, 2026
+//
+// This code is licensed under MIT license (see LICENSE.txt for details).
+
+#ifndef CONTEXTCREATEBENCHMARK_HEADER
+#define CONTEXTCREATEBENCHMARK_HEADER
+
+#include "BenchmarkRunner.h"
+#include "RendererProbe.h"
+
+//! Benchmark of context creation latency ("ctx-create").
+//! Unlike GlBenchmark, it is executed per platform and not on a context made current:
+//! each cycle creates a new probe (no shared session) and performs full CreateGlContext()/Release(),
+//! so that display connection and driver initialization are measured as well.
+//! Phases of the cycle are split using ProbeTimings spans recorded by context implementations.
+class ContextCreateBenchmark
+{
+public:
+
+  //! Measured phase of creation cycle.
+  enum Phase
+  {
+    Phase_Display,     //!< display connection and initialization (XOpenDisplay, eglInitialize, etc.)
+    Phase_Config,      //!< choosing config (eglChooseConfig, glXChooseFBConfig)
+    Phase_Context,     //!< creating context and surface
+    Phase_MakeCurrent, //!< first MakeCurrent
+    Phase_Release,     //!< context release and display termination
+    Phase_Total,       //!< complete cycle
+  };
+  enum { Phase_NB = Phase_Total + 1 };
+
+  //! Result of measured profile.
+  struct Result
+  {
+    std::string         Label;              //!< probe label like "[EGL] OpenGL (core profile)"
+    int                 NbFailures = 0;     //!< number of failed cycles
+    std::vector<double> Samples[Phase_NB];  //!< measured cycles in milliseconds per phase
+  };
+
+public:
+
+  //! Return benchmark name.
+  static const char* Name() { return "ctx-create"; }
+
+  //! Return benchmark description.
+  static const char* Description() { return "full CreateGlContext()/Release() cycle of each profile"; }
+
+  //! Return phase name.
+  static const char* PhaseName(Phase thePhase);
+
+  //! Return phase of ProbeTimings span name; Phase_Total for spans not assigned to any phase.
+  static Phase PhaseOf(const std::string& theSpan);
+
+public:
+
+  //! Main constructor.
+  ContextCreateBenchmark(const BenchmarkRunner::Options& theOptions) : myOptions(theOptions) {}
+
+  //! Measure creation cycles of profiles of the platform;
+  //! profiles which could not be created at the first cycle are skipped.
+  //! No other probe of the same platform should keep session alive while running.
+  std::vector<Result> Run(RendererProbe::Platform thePlatform, const RendererProbe::Options& theOptions);
+
+  //! Print per-phase statistics and histogram of the total latency.
+  void PrintHistogram(std::ostream& theStream, const Result& theResult) const;
+
+private:
+
+  //! Perform single creation cycle.
+  //! @return FALSE if context cannot be created
+  bool runCycle(RendererProbe::Platform thePlatform,
+                const RendererProbe::Options& theOptions,
+                BaseGlContext::ContextBits theBits,
+                double thePhases[Phase_NB],
+                std::string& thePlatformName);
+
+private:
+
+  BenchmarkRunner::Options myOptions;
+
+};
+
+#endif // CONTEXTCREATEBENCHMARK_HEADER
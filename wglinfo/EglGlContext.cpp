@@ -4,9 +4,12 @@
 
 #include "EglGlContext.h"
 
+#include "ProbeTimings.h"
+
 #include <cstring>
 #include <iomanip>
 #include <iostream>
+#include <sstream>
 #include <vector>
 #include <string>
 
@@ -16,6 +19,11 @@
   #endif
 #endif
 
+#ifndef GL_VENDOR
+#define GL_VENDOR   0x1F00
+#define GL_RENDERER 0x1F01
+#endif
+
 #if !defined(EGL_TRUE)
 #define EGL_TRUE                          1
 #define EGL_ALPHA_SIZE                    0x3021
@@ -156,6 +164,24 @@ template<typename FuncType_t> bool EglGlContext::findEglDllProc(const char* theF
 #define EGL_COLOR_COMPONENT_TYPE_FLOAT_EXT 0x333B
 #endif
 
+// EGL_MESA_platform_surfaceless
+#ifndef EGL_PLATFORM_SURFACELESS_MESA
+#define EGL_PLATFORM_SURFACELESS_MESA     0x31DD
+#endif
+
+// EGL_EXT_platform_device
+#ifndef EGL_PLATFORM_DEVICE_EXT
+#define EGL_PLATFORM_DEVICE_EXT           0x313F
+#endif
+
+// EGL_EXT_device_drm, EGL_EXT_device_drm_render_node
+#ifndef EGL_DRM_DEVICE_FILE_EXT
+#define EGL_DRM_DEVICE_FILE_EXT           0x3233
+#endif
+#ifndef EGL_DRM_RENDER_NODE_FILE_EXT
+#define EGL_DRM_RENDER_NODE_FILE_EXT      0x3377
+#endif
+
 #ifndef EGL_MIN_SWAP_INTERVAL
 #define EGL_MIN_SWAP_INTERVAL             0x303B
 #define EGL_MAX_SWAP_INTERVAL             0x303C
@@ -214,6 +240,7 @@ bool EglGlContext::LoadEglLibrary(bool theIsMandatory)
    || !findEglDllProcShort(eglCreateContext)
    || !findEglDllProcShort(eglDestroyContext)
    || !findEglDllProcShort(eglCreateWindowSurface)
+   || !findEglDllProcShort(eglCreatePbufferSurface)
    || !findEglDllProcShort(eglDestroySurface)
    || !findEglDllProcShort(eglQueryString))
   {
@@ -248,46 +275,169 @@ void EglGlContext::release()
     myEglContext = EGL_NO_CONTEXT;
   }
 
-  if (myEglDisp != EGL_NO_DISPLAY)
+  // display is terminated by the session when released by the last context
+  myEglDisp = EGL_NO_DISPLAY;
+  myEglSession.reset();
+}
+
+EglGlContext::DisplaySession::~DisplaySession()
+{
+  if (Display != EGL_NO_DISPLAY && Terminate != NULL)
   {
-    if (eglTerminate(myEglDisp) != EGL_TRUE)
+    ProbeTimings::Sentry aTimer("eglTerminate");
+    if (Terminate(Display) != EGL_TRUE)
       std::cerr << "Error: EGL, eglTerminate FAILED!\n";
-
-    myEglDisp = EGL_NO_DISPLAY;
   }
-  myWin->Destroy();
+  if (Window.get() != nullptr)
+    Window->Destroy();
 }
 
-unsigned int EglGlContext::GlGetError()
+bool EglGlContext::initSession(bool theToShare)
 {
-  if (this->glGetError == NULL)
-    FindProc("glGetError", this->glGetError);
+  if (theToShare)
+  {
+    std::shared_ptr<DisplaySession> aShared = std::dynamic_pointer_cast<DisplaySession>(mySession);
+    if (aShared.get() != nullptr)
+    {
+      myEglSession = aShared;
+      myEglDisp = aShared->Display;
+      return true;
+    }
+  }
 
-  return this->glGetError();
-}
+  std::shared_ptr<DisplaySession> aSession = std::make_shared<DisplaySession>();
+  aSession->Window = myWin;
 
-const char* EglGlContext::GlGetString(unsigned int theGlEnum)
-{
-  if (this->glGetString == NULL)
-    FindProc("glGetString", this->glGetString);
+  EGLDisplay anEglDisp = EGL_NO_DISPLAY;
+  if (myWin.get() == nullptr)
+  {
+    anEglDisp = getHeadlessDisplay();
+    if (anEglDisp == EGL_NO_DISPLAY)
+      return false;
+
+    // surfaceless/device platform returns the same display for every call,
+    // so that a private display (for software context) cannot be initialized separately
+    std::shared_ptr<DisplaySession> aShared = std::dynamic_pointer_cast<DisplaySession>(mySession);
+    // (RendererProbe::IsProfileSupported() excludes software profile on these platforms)
+    if (!theToShare && aShared.get() != nullptr && aShared->Display == anEglDisp)
+      return false;
+  }
+  else
+  {
+    {
+      ProbeTimings::Sentry aTimer("BaseWindow::Create");
+      if (!myWin->Create())
+        return false;
+    }
 
-  return (const char*)this->glGetString(theGlEnum);
+    {
+      ProbeTimings::Sentry aTimer("eglGetDisplay");
+      if (myWin->GetDisplay() != 0)
+        anEglDisp = eglGetDisplay((EGLNativeDisplayType)myWin->GetDisplay());
+      else
+        anEglDisp = eglGetDisplay(EGL_DEFAULT_DISPLAY);
+    }
+
+    if (anEglDisp == EGL_NO_DISPLAY)
+    {
+      std::cerr << "Error: no EGL display!\n";
+      return false;
+    }
+  }
+
+  {
+    ProbeTimings::Sentry aTimer("eglInitialize");
+    if (eglInitialize(anEglDisp, &aSession->VerMajor, &aSession->VerMinor) != EGL_TRUE)
+    {
+      std::cerr << "Error: EGL display is unavailable!\n";
+      return false;
+    }
+  }
+
+  aSession->Display   = anEglDisp;
+  aSession->Terminate = eglTerminate;
+  aSession->Extensions.Init(eglQueryString(anEglDisp, EGL_EXTENSIONS));
+  myEglSession = aSession;
+  myEglDisp = anEglDisp;
+  if (theToShare)
+    mySession = aSession;
+
+  return true;
 }
 
-const char* EglGlContext::GlGetStringi(unsigned int theGlEnum, unsigned int theIndex)
+bool EglGlContext::QueryDevices(std::vector<void*>& theDevices)
 {
-  if (this->glGetStringi == NULL)
-    FindProc("glGetStringi", this->glGetStringi);
+  typedef EGLBoolean (EGLAPIENTRY *eglQueryDevicesEXT_t)(EGLint theMaxDevices, void** theDevices, EGLint* theNbDevices);
+
+  theDevices.clear();
+  if (!LoadEglLibrary())
+    return false;
+
+  const ExtensionSet aClientExts(eglQueryString(EGL_NO_DISPLAY, EGL_EXTENSIONS));
+  if (!aClientExts.Has("EGL_EXT_device_enumeration")
+   || !aClientExts.Has("EGL_EXT_platform_device"))
+  {
+    eglGetError();
+    std::cerr << "Error: EGL does not support EGL_EXT_device_enumeration!\n";
+    return false;
+  }
+
+  eglQueryDevicesEXT_t aQueryDevices = NULL;
+  if (!FindProc("eglQueryDevicesEXT", aQueryDevices))
+  {
+    std::cerr << "Error: EGL does not provide eglQueryDevicesEXT()!\n";
+    return false;
+  }
+
+  ProbeTimings::Sentry aTimer("eglQueryDevicesEXT");
+  EGLint aNbDevices = 0;
+  if (aQueryDevices(0, NULL, &aNbDevices) != EGL_TRUE
+   || aNbDevices <= 0)
+  {
+    std::cerr << "Error: EGL has no devices!\n";
+    return false;
+  }
 
-  return (const char*)this->glGetStringi(theGlEnum, theIndex);
+  theDevices.resize(aNbDevices);
+  if (aQueryDevices(aNbDevices, theDevices.data(), &aNbDevices) != EGL_TRUE)
+  {
+    theDevices.clear();
+    return false;
+  }
+  theDevices.resize(aNbDevices);
+  return !theDevices.empty();
 }
 
-void EglGlContext::GlGetIntegerv(unsigned int theGlEnum, int* theParams)
+EGLDisplay EglGlContext::getHeadlessDisplay()
 {
-  if (this->glGetIntegerv == NULL)
-    FindProc("glGetIntegerv", this->glGetIntegerv);
+  typedef EGLDisplay (EGLAPIENTRY *eglGetPlatformDisplay_t)(EGLenum thePlatform, void* theNativeDisplay, const EGLint* theAttribs);
 
-  this->glGetIntegerv(theGlEnum, theParams);
+  // client extensions are returned for EGL_NO_DISPLAY (EGL_EXT_client_extensions)
+  const char* aPlatformExt = myEglDevice != nullptr ? "EGL_EXT_platform_device" : "EGL_MESA_platform_surfaceless";
+  const ExtensionSet aClientExts(eglQueryString(EGL_NO_DISPLAY, EGL_EXTENSIONS));
+  if (!aClientExts.Has(aPlatformExt))
+  {
+    eglGetError();
+    std::cerr << "Error: EGL does not support " << aPlatformExt << "!\n";
+    return EGL_NO_DISPLAY;
+  }
+
+  eglGetPlatformDisplay_t aGetPlatformDisplay = NULL;
+  if (!FindProc("eglGetPlatformDisplayEXT", aGetPlatformDisplay)
+   && !FindProc("eglGetPlatformDisplay", aGetPlatformDisplay))
+  {
+    std::cerr << "Error: EGL does not provide eglGetPlatformDisplay()!\n";
+    return EGL_NO_DISPLAY;
+  }
+
+  ProbeTimings::Sentry aTimer("eglGetPlatformDisplay");
+  EGLDisplay anEglDisp = myEglDevice != nullptr
+                       ? aGetPlatformDisplay(EGL_PLATFORM_DEVICE_EXT, myEglDevice, NULL)
+                       : aGetPlatformDisplay(EGL_PLATFORM_SURFACELESS_MESA, EGL_DEFAULT_DISPLAY, NULL);
+  if (anEglDisp == EGL_NO_DISPLAY)
+    std::cerr << "Error: no EGL " << (myEglDevice != nullptr ? "device" : "surfaceless") << " display!\n";
+
+  return anEglDisp;
 }
 
 bool EglGlContext::MakeCurrent()
@@ -318,39 +468,43 @@ bool EglGlContext::CreateGlContext(ContextBits theBits)
   #ifdef _WIN32
     return false;
   #else
-    EglGlContext aCtxCompat(myWin->EmptyCopy("wglinfoTmp"));
-    if (!aCtxCompat.CreateGlContext(ContextBits_NONE)
-     || !aMesaEnvSentry.Init(aCtxCompat))
+    ProbeTimings::Sentry aTimer("SoftMesaSentry::Init");
+    std::shared_ptr<DisplaySession> aShared = std::dynamic_pointer_cast<DisplaySession>(mySession);
+    if (aShared.get() != nullptr && !aShared->Renderer.empty())
     {
-      return false;
+      // reuse renderer of another profile created on the shared display
+      if (!aMesaEnvSentry.Init(SoftMesaSentry::IsSoftRenderer(aShared->Vendor, aShared->Renderer)))
+        return false;
+    }
+    else
+    {
+      // temporary context borrows (or initializes) the shared display,
+      // while software context requires a private one initialized with modified environment
+      EglGlContext aCtxCompat(myWin.get() != nullptr ? myWin->EmptyCopy("wglinfoTmp") : std::shared_ptr<BaseWindow>());
+      aCtxCompat.SetSession(mySession);
+      const bool isCompatCreated = aCtxCompat.CreateGlContext(ContextBits_NONE);
+      if (mySession.get() == nullptr)
+        mySession = aCtxCompat.Session();
+
+      if (!isCompatCreated
+       || !aMesaEnvSentry.Init(aCtxCompat))
+      {
+        return false;
+      }
     }
   #endif
   }
 
-  if (!myWin->Create())
+  if (!initSession(!isSoftCtx))
   {
     Release();
     return false;
   }
 
-  if (myWin->GetDisplay() != 0)
-    myEglDisp = eglGetDisplay((EGLNativeDisplayType)myWin->GetDisplay());
-  else
-    myEglDisp = eglGetDisplay(EGL_DEFAULT_DISPLAY);
-
-  if (myEglDisp == EGL_NO_DISPLAY)
-  {
-    std::cerr << "Error: no EGL display!\n";
-    return false;
-  }
-
-  EGLint aVerMajor = 0, aVerMinor = 0;
-  if (eglInitialize(myEglDisp, &aVerMajor, &aVerMinor) != EGL_TRUE)
-  {
-    std::cerr << "Error: EGL display is unavailable!\n";
-    return false;
-  }
-
+  // offscreen context on a window system keeps window config, unless PBuffer is required
+  const bool hasSurfaceless = myEglSession->Extensions.Has("EGL_KHR_surfaceless_context");
+  const bool hasWindow   = myEglSession->Window.get() != nullptr;
+  const bool toUseWindow = hasWindow && !myIsOffscreen;
   EGLint aConfigAttribs[] =
   {
     EGL_RED_SIZE,     8,
@@ -360,10 +514,12 @@ bool EglGlContext::CreateGlContext(ContextBits theBits)
     EGL_DEPTH_SIZE,   24,
     EGL_STENCIL_SIZE, 8,
     EGL_RENDERABLE_TYPE, EGL_OPENGL_BIT,
+    EGL_SURFACE_TYPE, toUseWindow || (hasWindow && hasSurfaceless) ? EGL_WINDOW_BIT : EGL_PBUFFER_BIT,
     EGL_NONE
   };
 
   EGLConfig anEglCfg = NULL;
+  ProbeTimings::Sentry aChooseTimer("eglChooseConfig");
   for (int aGlesVer = isGles ? 3 : 2; aGlesVer >= 2; --aGlesVer)
   {
     aConfigAttribs[6 * 2 + 1] = isGles ? (aGlesVer == 3 ? EGL_OPENGL_ES3_BIT : EGL_OPENGL_ES2_BIT) : EGL_OPENGL_BIT;
@@ -383,6 +539,7 @@ bool EglGlContext::CreateGlContext(ContextBits theBits)
     }
     break;
   }
+  aChooseTimer.Stop();
   if (anEglCfg == NULL)
   {
     //std::cerr << "Error: EGL does not provide compatible configurations!\n";
@@ -403,10 +560,14 @@ bool EglGlContext::CreateGlContext(ContextBits theBits)
       EGL_CONTEXT_CLIENT_VERSION, hasGLES3 ? 3 : 2, EGL_NONE, EGL_NONE
     };
 
-    myEglContext = eglCreateContext(myEglDisp, anEglCfg, EGL_NO_CONTEXT, aCtxAttribs);
+    {
+      ProbeTimings::Sentry aTimer("eglCreateContext", aCtxAttribs[1], 0);
+      myEglContext = eglCreateContext(myEglDisp, anEglCfg, EGL_NO_CONTEXT, aCtxAttribs);
+    }
     if (myEglContext == EGL_NO_CONTEXT && hasGLES3)
     {
       aCtxAttribs[1] = 2;
+      ProbeTimings::Sentry aTimer("eglCreateContext", aCtxAttribs[1], 0);
       myEglContext = eglCreateContext(myEglDisp, anEglCfg, EGL_NO_CONTEXT, aCtxAttribs);
     }
   }
@@ -422,22 +583,35 @@ bool EglGlContext::CreateGlContext(ContextBits theBits)
       EGL_NONE, EGL_NONE
     };
 
+    // try the version already known to be supported by the display first
+    const VersionHint& aHint = isCoreCtx ? myEglSession->CoreVersion : myEglSession->CompatVersion;
+    if (aHint.IsValid())
+    {
+      aCtxAttribs[1] = aHint.Major;
+      aCtxAttribs[3] = aHint.Minor;
+      ProbeTimings::Sentry aTimer("eglCreateContext", aCtxAttribs[1], aCtxAttribs[3]);
+      myEglContext = eglCreateContext(myEglDisp, anEglCfg, EGL_NO_CONTEXT, aCtxAttribs);
+    }
+
     // try to create the core profile of highest OpenGL version
     for (int aLowVer4 = 5; aLowVer4 >= 0 && myEglContext == EGL_NO_CONTEXT; --aLowVer4)
     {
       aCtxAttribs[1] = 4;
       aCtxAttribs[3] = aLowVer4;
+      ProbeTimings::Sentry aTimer("eglCreateContext", aCtxAttribs[1], aCtxAttribs[3]);
       myEglContext = eglCreateContext(myEglDisp, anEglCfg, EGL_NO_CONTEXT, aCtxAttribs);
     }
     for (int aLowVer3 = 3; aLowVer3 >= 2 && myEglContext == EGL_NO_CONTEXT; --aLowVer3)
     {
       aCtxAttribs[1] = 3;
       aCtxAttribs[3] = aLowVer3;
+      ProbeTimings::Sentry aTimer("eglCreateContext", aCtxAttribs[1], aCtxAttribs[3]);
       myEglContext = eglCreateContext(myEglDisp, anEglCfg, EGL_NO_CONTEXT, aCtxAttribs);
     }
   }
   else
   {
+    ProbeTimings::Sentry aTimer("eglCreateContext");
     myEglContext = eglCreateContext(myEglDisp, anEglCfg, EGL_NO_CONTEXT, NULL);
   }
 
@@ -447,18 +621,63 @@ bool EglGlContext::CreateGlContext(ContextBits theBits)
     return false;
   }
 
-  myEglSurf = eglCreateWindowSurface(myEglDisp, anEglCfg, (EGLNativeWindowType)myWin->GetDrawable(), NULL);
-  if (myEglSurf == EGL_NO_SURFACE)
+  if (toUseWindow)
   {
-    std::cerr << "Error: EGL is unable to create surface for window!\n";
-    return false;
+    {
+      ProbeTimings::Sentry aTimer("eglCreateWindowSurface");
+      myEglSurf = eglCreateWindowSurface(myEglDisp, anEglCfg, (EGLNativeWindowType)myEglSession->Window->GetDrawable(), NULL);
+    }
+    if (myEglSurf == EGL_NO_SURFACE)
+    {
+      std::cerr << "Error: EGL is unable to create surface for window!\n";
+      return false;
+    }
+  }
+  else if (!hasSurfaceless)
+  {
+    // headless context without EGL_KHR_surfaceless_context requires a dummy surface
+    const EGLint aPBufferAttribs[] = { EGL_WIDTH, 1, EGL_HEIGHT, 1, EGL_NONE };
+    {
+      ProbeTimings::Sentry aTimer("eglCreatePbufferSurface");
+      myEglSurf = eglCreatePbufferSurface(myEglDisp, anEglCfg, aPBufferAttribs);
+    }
+    if (myEglSurf == EGL_NO_SURFACE)
+    {
+      std::cerr << "Error: EGL is unable to create PBuffer surface!\n";
+      return false;
+    }
   }
 
+  ProbeTimings::Sentry aMakeCurrentTimer("MakeCurrent");
   if (!MakeCurrent())
   {
     std::cerr << "Error: eglMakeCurrent() has failed!\n";
     return false;
   }
+  aMakeCurrentTimer.Stop();
+  loadGlFunctions();
+
+  if (!isSoftCtx && myEglSession->Renderer.empty())
+  {
+    // remember default renderer to detect software one without a temporary context
+    const char* aVendor = GlGetString(GL_VENDOR);
+    const char* aRender = GlGetString(GL_RENDERER);
+    myEglSession->Vendor   = aVendor != nullptr ? aVendor : "";
+    myEglSession->Renderer = aRender != nullptr ? aRender : "";
+  }
+
+  if (!isGles)
+  {
+    // remember version for creating next contexts on this display;
+    // compatible profile of 3.2+ also implies availability of the same core profile version
+    VersionHint& aHint = isCoreCtx ? myEglSession->CoreVersion : myEglSession->CompatVersion;
+    if (updateVersionHint(aHint)
+     && !isCoreCtx
+     && !myEglSession->CoreVersion.IsValid())
+    {
+      myEglSession->CoreVersion = aHint;
+    }
+  }
 
 #ifndef _WIN32
   if (isSoftCtx && !aMesaEnvSentry.IsSoftContext(*this))
@@ -471,22 +690,52 @@ bool EglGlContext::CreateGlContext(ContextBits theBits)
   return true;
 }
 
-void EglGlContext::PrintPlatformInfo(bool theToPrintExtensions)
+void EglGlContext::CollectPlatformInfo(RendererReport& theReport, bool theToCollectExtensions)
 {
   if (myEglDisp == EGL_NO_DISPLAY)
     return;
 
-  std::cout << "[" << PlatformName() << "] EGLVersion:    " << eglQueryString(myEglDisp, EGL_VERSION) << "\n";
-  std::cout << "[" << PlatformName() << "] EGLVendor:     " << eglQueryString(myEglDisp, EGL_VENDOR) << "\n";
-  std::cout << "[" << PlatformName() << "] EGLClientAPIs: " << eglQueryString(myEglDisp, EGL_CLIENT_APIS) << "\n";
-  if (theToPrintExtensions)
-  {
-    std::cout << "[" << PlatformName() << "] EGL extensions:\n";
-    printExtensions(eglQueryString(myEglDisp, EGL_EXTENSIONS));
-  }
+  theReport.Sections |= RendererReport::Section_Platform;
+  theReport.PlatformLabelWidth = 14;
+  theReport.AddPlatformProperty("EGLVersion",    eglQueryString(myEglDisp, EGL_VERSION));
+  theReport.AddPlatformProperty("EGLVendor",     eglQueryString(myEglDisp, EGL_VENDOR));
+  theReport.AddPlatformProperty("EGLClientAPIs", eglQueryString(myEglDisp, EGL_CLIENT_APIS));
+  if (myEglDevice != nullptr)
+    collectDeviceInfo(theReport, theToCollectExtensions);
+
+  if (theToCollectExtensions)
+    theReport.AddPlatformExtensions("EGLExtensions", "EGL extensions", eglQueryString(myEglDisp, EGL_EXTENSIONS));
+}
+
+void EglGlContext::collectDeviceInfo(RendererReport& theReport, bool theToCollectExtensions)
+{
+  typedef const char* (EGLAPIENTRY *eglQueryDeviceStringEXT_t)(void* theDevice, EGLint theName);
+
+  eglQueryDeviceStringEXT_t aQueryDeviceString = NULL;
+  if (!FindProc("eglQueryDeviceStringEXT", aQueryDeviceString))
+    return;
+
+  const char* aDevExts = aQueryDeviceString(myEglDevice, EGL_EXTENSIONS);
+  if (aDevExts == NULL)
+    return;
+
+  const ExtensionSet aDevExtSet(aDevExts);
+  const char* aDevFile  = aDevExtSet.Has("EGL_EXT_device_drm")
+                       ? aQueryDeviceString(myEglDevice, EGL_DRM_DEVICE_FILE_EXT) : NULL;
+  const char* aNodeFile = aDevExtSet.Has("EGL_EXT_device_drm_render_node")
+                       ? aQueryDeviceString(myEglDevice, EGL_DRM_RENDER_NODE_FILE_EXT) : NULL;
+  if (aDevFile != NULL)
+    theReport.AddPlatformProperty("EGLDeviceFile", aDevFile);
+  if (aNodeFile != NULL)
+    theReport.AddPlatformProperty("EGLRenderNode", aNodeFile);
+  if (aDevExtSet.Has("EGL_MESA_device_software"))
+    theReport.AddPlatformProperty("EGLDeviceType", "software");
+
+  if (theToCollectExtensions)
+    theReport.AddPlatformExtensions("EGLDeviceExtensions", "EGL device extensions", aDevExts);
 }
 
-void EglGlContext::PrintVisuals(bool theIsVerbose)
+void EglGlContext::CollectVisuals(RendererReport& theReport, bool theIsVerbose)
 {
   if (myEglDisp == EGL_NO_DISPLAY)
     return;
@@ -497,7 +746,9 @@ void EglGlContext::PrintVisuals(bool theIsVerbose)
 #endif
 
   // poor solution to detect software OpenGL implementation
-  const bool isSoftMesa = SoftMesaSentry::IsSoftContext(*this);
+  const bool isSoftMesa = !myEglSession->Renderer.empty() && (myCtxBits & ContextBits_SoftProfile) == 0
+                        ? SoftMesaSentry::IsSoftRenderer(myEglSession->Vendor, myEglSession->Renderer)
+                        : SoftMesaSentry::IsSoftContext(*this);
 
   struct EGLConfigAttribs
   {
@@ -529,16 +780,13 @@ void EglGlContext::PrintVisuals(bool theIsVerbose)
   if (eglGetConfigs(myEglDisp, aConfigs.data(), aNbConfigs, &aNbConfigs) != EGL_TRUE)
     return;
 
-  std::string anEglExt;
-  if (const char* anEglExtRaw = eglQueryString(myEglDisp, EGL_EXTENSIONS))
-    anEglExt = anEglExtRaw;
+  const ExtensionSet& anEglExt = myEglSession->Extensions;
+  const bool hasExtPixFormatFloat = anEglExt.Has("EGL_EXT_pixel_format_float");
+  const bool hasExtGlColorspace   = anEglExt.Has("EGL_KHR_gl_colorspace");
 
-  const bool hasExtPixFormatFloat = hasExtension(anEglExt, "EGL_EXT_pixel_format_float");
-  const bool hasExtGlColorspace   = hasExtension(anEglExt, "EGL_KHR_gl_colorspace");
-
-  std::cout << "\n[" << PlatformName() << "] " << aNbConfigs << " EGL Configs\n";
-  if (!theIsVerbose)
-    VisualInfo::PrintTableHeader(true);
+  theReport.Sections |= RendererReport::Section_Visuals;
+  theReport.VisualsTitle = std::to_string(aNbConfigs) + " EGL Configs";
+  theReport.IsVerboseVisuals = theIsVerbose;
 
   for (int aCfgIter = 0; aCfgIter < aNbConfigs; ++aCfgIter)
   {
@@ -626,13 +874,12 @@ void EglGlContext::PrintVisuals(bool theIsVerbose)
     anInfo.AccumBlueSize  = 0;
     anInfo.AccumAlphaSize = 0;
 
+    theReport.Visuals.push_back(anInfo);
     if (!theIsVerbose)
-    {
-      anInfo.PrintTableLine();
       continue;
-    }
 
-    std::cout << "Config: " << aCfgIter << " (0x" << std::hex << anAttribs.ConfigId << std::dec << ")" << "\n"
+    std::stringstream aDetails;
+    aDetails << "Config: " << aCfgIter << " (0x" << std::hex << anAttribs.ConfigId << std::dec << ")" << "\n"
       << "    color: R" << anAttribs.RedSize << "G" << anAttribs.GreenSize << "B" << anAttribs.BlueSize << "A" << anAttribs.AlphaSize
       << " (" << getColorBufferClass(anAttribs.ColorSize, anAttribs.RedSize) << ", " << anAttribs.ColorSize << ")"
       << " depth: " << anAttribs.DepthSize << " stencil: " << anAttribs.StencilSize
@@ -643,26 +890,23 @@ void EglGlContext::PrintVisuals(bool theIsVerbose)
       case EGL_NONE:
         break;
       case EGL_SLOW_CONFIG:
-        std::cout << "    caveat: slow\n";
+        aDetails << "    caveat: slow\n";
         break;
       case EGL_NON_CONFORMANT_CONFIG:
-        std::cout << "    caveat: non-conformant\n";
+        aDetails << "    caveat: non-conformant\n";
         break;
       default:
-        std::cout << "    caveat: " << std::hex << anAttribs.ConfigCaveat << std::dec <<  "\n";
+        aDetails << "    caveat: " << std::hex << anAttribs.ConfigCaveat << std::dec <<  "\n";
         break;
     }
 
-    std::cout << "    nativeRenderable: " << anAttribs.NativeRenderable
+    aDetails << "    nativeRenderable: " << anAttribs.NativeRenderable
               << " visualID: " << anAttribs.NativeVisualId
               << " visualType: " << anAttribs.NativeVisualType << "\n";
 
-    std::cout << "    renderableTypes: " << ((anAttribs.RenderbableType & EGL_OPENGL_ES2_BIT) != 0 ? "GLES2 " : " ")
+    aDetails << "    renderableTypes: " << ((anAttribs.RenderbableType & EGL_OPENGL_ES2_BIT) != 0 ? "GLES2 " : " ")
       << ((anAttribs.RenderbableType & EGL_OPENGL_ES3_BIT) != 0 ? "GLES3 " : " ")
       << ((anAttribs.RenderbableType & EGL_OPENGL_BIT) != 0 ? "GL" : " ") << "\n";
+    theReport.VisualDetails.push_back(aDetails.str());
   }
-
-  // table footer
-  if (!theIsVerbose)
-    VisualInfo::PrintTableHeader(false);
 }
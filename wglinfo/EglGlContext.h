@@ -16,6 +16,8 @@
 
 #include "BaseGlContext.h"
 
+#include <vector>
+
 //! EGL OpenGL/GLES context creation tool.
 class EglGlContext : public BaseGlContext
 {
@@ -25,6 +27,7 @@ public:
   EglGlContext(const std::string& theTitle);
 
   //! Constructor from native window.
+  //! NULL window defines headless context created on surfaceless platform (EGL_MESA_platform_surfaceless).
   EglGlContext(const std::shared_ptr<BaseWindow>& theWin);
 
   //! Destructor.
@@ -33,9 +36,28 @@ public:
   //! Load EGL library.
   bool LoadEglLibrary(bool theIsMandatory = false);
 
+  //! Enumerate EGL devices (EGL_EXT_device_enumeration).
+  bool QueryDevices(std::vector<void*>& theDevices);
+
+  //! Set EGL device (EGLDeviceEXT) to create headless context on (EGL_EXT_platform_device);
+  //! should be called before CreateGlContext() for context constructed with NULL window.
+  void SetEglDevice(void* theDevice, int theDeviceIndex)
+  {
+    myEglDevice = theDevice;
+    myPlatformName = theDevice != nullptr ? std::string("EGL-device") + std::to_string(theDeviceIndex) : std::string();
+  }
+
+  //! Create context without window surface (surfaceless or 1x1 PBuffer) even when window is defined;
+  //! should be called before CreateGlContext() to keep several contexts alive, as native window accepts only one surface.
+  void SetOffscreen(bool theIsOffscreen) { myIsOffscreen = theIsOffscreen; }
+
   //! Return platform name "EGL".
   virtual const char* PlatformName() const override
   {
+    if (!myPlatformName.empty())
+      return myPlatformName.c_str();
+    if (myWin.get() == nullptr)
+      return "EGL-surfaceless";
 #ifdef HAVE_WAYLAND
     return dynamic_cast<WlWindow*>(myWin.get()) != nullptr
          ? "EGL-wayland"
@@ -56,26 +78,14 @@ public:
 
 public:
 
-  //! Print WGL platform info.
-  virtual void PrintPlatformInfo(bool theToPrintExtensions) override;
+  //! Collect EGL platform info.
+  virtual void CollectPlatformInfo(RendererReport& theReport, bool theToCollectExtensions) override;
 
-  //! Print EGL configs.
-  virtual void PrintVisuals(bool theIsVerbose) override;
+  //! Collect EGL configs.
+  virtual void CollectVisuals(RendererReport& theReport, bool theIsVerbose) override;
 
 public:
 
-  //! glGetError() wrapper.
-  virtual unsigned int GlGetError() override;
-
-  //! glGetString() wrapper.
-  virtual const char* GlGetString(unsigned int theGlEnum) override;
-
-  //! glGetStringi() wrapper.
-  virtual const char* GlGetStringi(unsigned int theGlEnum, unsigned int theIndex) override;
-
-  //! glGetIntegerv() wrapper.
-  virtual void GlGetIntegerv(unsigned int theGlEnum, int* theParams) override;
-
   //! Wrapper to system function to retrieve GL function pointer by name.
   virtual void* GlGetProcAddress(const char* theFuncName) override;
 
@@ -124,6 +134,7 @@ private:
   typedef EGLContext  (EGLAPIENTRY *eglCreateContext_t) (EGLDisplay dpy, EGLConfig config, EGLContext share_context, const EGLint *attrib_list);
   typedef EGLBoolean  (EGLAPIENTRY *eglDestroyContext_t) (EGLDisplay dpy, EGLContext ctx);
   typedef EGLSurface  (EGLAPIENTRY *eglCreateWindowSurface_t) (EGLDisplay dpy, EGLConfig config, EGLNativeWindowType win, const EGLint *attrib_list);
+  typedef EGLSurface  (EGLAPIENTRY *eglCreatePbufferSurface_t) (EGLDisplay dpy, EGLConfig config, const EGLint *attrib_list);
   typedef EGLBoolean  (EGLAPIENTRY *eglDestroySurface_t) (EGLDisplay dpy, EGLSurface surface);
   typedef const char* (EGLAPIENTRY *eglQueryString_t) (EGLDisplay dpy, EGLint name);
 
@@ -147,31 +158,56 @@ private:
   eglCreateContext_t eglCreateContext = NULL;
   eglDestroyContext_t eglDestroyContext = NULL;
   eglCreateWindowSurface_t eglCreateWindowSurface = NULL;
+  eglCreatePbufferSurface_t eglCreatePbufferSurface = NULL;
   eglDestroySurface_t eglDestroySurface = NULL;
   eglQueryString_t eglQueryString = NULL;
 #endif
 
-private:
+public:
 
-  typedef unsigned int         (EGLAPIENTRY *glGetError_t)(void);
-  typedef const unsigned char* (EGLAPIENTRY *glGetString_t)(unsigned int name);
-  typedef const unsigned char* (EGLAPIENTRY *glGetStringi_t)(unsigned int name, unsigned int index);
-  typedef void                 (EGLAPIENTRY *glGetIntegerv_t)(unsigned int name, int* params);
+  //! EGL display initialized once and shared by contexts of all probed profiles.
+  //! The display is terminated and the window is destroyed when the last context releases the session.
+  class DisplaySession : public PlatformSession
+  {
+  public:
+    //! Destructor, calls eglTerminate().
+    virtual ~DisplaySession();
+
+  public:
+    std::shared_ptr<BaseWindow> Window; //!< window providing native display and drawable
+    EGLDisplay Display = EGL_NO_DISPLAY;
+    EGLint VerMajor = 0;
+    EGLint VerMinor = 0;
+    ExtensionSet Extensions; //!< display extensions
+    VersionHint CoreVersion;   //!< highest OpenGL version of core profile created on this display
+    VersionHint CompatVersion; //!< highest OpenGL version of compatibility profile created on this display
+    std::string Vendor;        //!< GL_VENDOR of the first non-software context created on this display
+    std::string Renderer;      //!< GL_RENDERER of the first non-software context created on this display
+    EGLBoolean (EGLAPIENTRY *Terminate)(EGLDisplay theDisp) = NULL; //!< eglTerminate() from the library
+  };
 
 private:
 
-  glGetError_t glGetError = NULL;
-  glGetString_t glGetString = NULL;
-  glGetStringi_t glGetStringi = NULL;
-  glGetIntegerv_t glGetIntegerv = NULL;
+  //! Borrow the shared display session or initialize a new one.
+  bool initSession(bool theToShare);
+
+  //! Return display of device or surfaceless platform, or EGL_NO_DISPLAY if unsupported.
+  EGLDisplay getHeadlessDisplay();
+
+  //! Collect EGL device info.
+  void collectDeviceInfo(RendererReport& theReport, bool theToCollectExtensions);
 
 protected:
 
+  std::shared_ptr<DisplaySession> myEglSession; //!< shared or private (software profile) display session
   EGLDisplay myEglDisp = EGL_NO_DISPLAY;
   EGLContext myEglContext = EGL_NO_CONTEXT;
   EGLSurface myEglSurf = EGL_NO_SURFACE;
 
   std::shared_ptr<BaseWindow> myWin;
+  void*       myEglDevice = nullptr; //!< EGLDeviceEXT for headless device platform
+  std::string myPlatformName;        //!< platform name for device platform
+  bool        myIsOffscreen = false; //!< create no window surface
 
 };
 
@@ -187,4 +223,15 @@ public:
   }
 };
 
+//! Headless EGL OpenGL/GLES context creation tool, which doesn't require X11/Wayland server.
+class EglSurfacelessContext : public EglGlContext
+{
+public:
+  EglSurfacelessContext(const std::string& )
+  : EglGlContext(std::shared_ptr<BaseWindow>())
+  {
+    //
+  }
+};
+
 #endif // EGLGLCONTEXT_HEADER
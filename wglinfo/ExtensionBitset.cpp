@@ -0,0 +1,1450 @@
+// Copyright © Kirill Gavrilov, 2026
+//
+// This code is licensed under MIT license (see LICENSE.txt for details).
+
+#include "ExtensionBitset.h"
+
+#include <algorithm>
+
+namespace
+{
+  //! Registry of known extensions sorted by name (strcmp order); bit index is position in this table.
+  //! Names could be added at any place keeping the order, which changes ExtensionBitset::RegistryId().
+  static constexpr const char* THE_KNOWN_EXTENSIONS[] =
+  {
+    "EGL_ANDROID_GLES_layers",
+    "EGL_ANDROID_blob_cache",
+    "EGL_ANDROID_create_native_client_buffer",
+    "EGL_ANDROID_framebuffer_target",
+    "EGL_ANDROID_front_buffer_auto_refresh",
+    "EGL_ANDROID_get_frame_timestamps",
+    "EGL_ANDROID_get_native_client_buffer",
+    "EGL_ANDROID_image_native_buffer",
+    "EGL_ANDROID_native_fence_sync",
+    "EGL_ANDROID_presentation_time",
+    "EGL_ANDROID_recordable",
+    "EGL_ANGLE_d3d_share_handle_client_buffer",
+    "EGL_ANGLE_device_d3d",
+    "EGL_ANGLE_query_surface_pointer",
+    "EGL_ANGLE_surface_d3d_texture_2d_share_handle",
+    "EGL_ANGLE_sync_control_rate",
+    "EGL_ANGLE_window_fixed_size",
+    "EGL_ARM_image_format",
+    "EGL_ARM_implicit_external_sync",
+    "EGL_ARM_pixmap_multisample_discard",
+    "EGL_CHROMIUM_sync_control",
+    "EGL_EXT_bind_to_front",
+    "EGL_EXT_buffer_age",
+    "EGL_EXT_client_extensions",
+    "EGL_EXT_client_sync",
+    "EGL_EXT_compositor",
+    "EGL_EXT_config_select_group",
+    "EGL_EXT_create_context_robustness",
+    "EGL_EXT_device_base",
+    "EGL_EXT_device_drm",
+    "EGL_EXT_device_drm_render_node",
+    "EGL_EXT_device_enumeration",
+    "EGL_EXT_device_openwf",
+    "EGL_EXT_device_persistent_id",
+    "EGL_EXT_device_query",
+    "EGL_EXT_device_query_name",
+    "EGL_EXT_gl_colorspace_bt2020_linear",
+    "EGL_EXT_gl_colorspace_bt2020_pq",
+    "EGL_EXT_gl_colorspace_display_p3",
+    "EGL_EXT_gl_colorspace_display_p3_linear",
+    "EGL_EXT_gl_colorspace_display_p3_passthrough",
+    "EGL_EXT_gl_colorspace_scrgb",
+    "EGL_EXT_gl_colorspace_scrgb_linear",
+    "EGL_EXT_image_dma_buf_import",
+    "EGL_EXT_image_dma_buf_import_modifiers",
+    "EGL_EXT_image_gl_colorspace",
+    "EGL_EXT_image_implicit_sync_control",
+    "EGL_EXT_multiview_window",
+    "EGL_EXT_output_base",
+    "EGL_EXT_output_drm",
+    "EGL_EXT_output_openwf",
+    "EGL_EXT_pixel_format_float",
+    "EGL_EXT_platform_base",
+    "EGL_EXT_platform_device",
+    "EGL_EXT_platform_wayland",
+    "EGL_EXT_platform_x11",
+    "EGL_EXT_platform_xcb",
+    "EGL_EXT_present_opaque",
+    "EGL_EXT_protected_content",
+    "EGL_EXT_protected_surface",
+    "EGL_EXT_stream_consumer_egloutput",
+    "EGL_EXT_surface_CTA861_3_metadata",
+    "EGL_EXT_surface_SMPTE2086_metadata",
+    "EGL_EXT_surface_compression",
+    "EGL_EXT_swap_buffers_with_damage",
+    "EGL_EXT_sync_reuse",
+    "EGL_EXT_yuv_surface",
+    "EGL_HI_clientpixmap",
+    "EGL_HI_colorformats",
+    "EGL_IMG_context_priority",
+    "EGL_IMG_image_plane_attribs",
+    "EGL_KHR_cl_event",
+    "EGL_KHR_cl_event2",
+    "EGL_KHR_client_get_all_proc_addresses",
+    "EGL_KHR_config_attribs",
+    "EGL_KHR_context_flush_control",
+    "EGL_KHR_create_context",
+    "EGL_KHR_create_context_no_error",
+    "EGL_KHR_debug",
+    "EGL_KHR_display_reference",
+    "EGL_KHR_fence_sync",
+    "EGL_KHR_get_all_proc_addresses",
+    "EGL_KHR_gl_colorspace",
+    "EGL_KHR_gl_renderbuffer_image",
+    "EGL_KHR_gl_texture_2D_image",
+    "EGL_KHR_gl_texture_3D_image",
+    "EGL_KHR_gl_texture_cubemap_image",
+    "EGL_KHR_image",
+    "EGL_KHR_image_base",
+    "EGL_KHR_image_pixmap",
+    "EGL_KHR_lock_surface",
+    "EGL_KHR_lock_surface2",
+    "EGL_KHR_lock_surface3",
+    "EGL_KHR_mutable_render_buffer",
+    "EGL_KHR_no_config_context",
+    "EGL_KHR_partial_update",
+    "EGL_KHR_platform_android",
+    "EGL_KHR_platform_gbm",
+    "EGL_KHR_platform_wayland",
+    "EGL_KHR_platform_x11",
+    "EGL_KHR_reusable_sync",
+    "EGL_KHR_stream",
+    "EGL_KHR_stream_attrib",
+    "EGL_KHR_stream_consumer_gltexture",
+    "EGL_KHR_stream_cross_process_fd",
+    "EGL_KHR_stream_fifo",
+    "EGL_KHR_stream_producer_aldatalocator",
+    "EGL_KHR_stream_producer_eglsurface",
+    "EGL_KHR_surfaceless_context",
+    "EGL_KHR_swap_buffers_with_damage",
+    "EGL_KHR_vg_parent_image",
+    "EGL_KHR_wait_sync",
+    "EGL_MESA_configless_context",
+    "EGL_MESA_device_software",
+    "EGL_MESA_drm_image",
+    "EGL_MESA_image_dma_buf_export",
+    "EGL_MESA_platform_gbm",
+    "EGL_MESA_platform_surfaceless",
+    "EGL_MESA_query_driver",
+    "EGL_NOK_swap_region",
+    "EGL_NOK_swap_region2",
+    "EGL_NOK_texture_from_pixmap",
+    "EGL_NV_3dvision_surface",
+    "EGL_NV_context_priority_realtime",
+    "EGL_NV_coverage_sample",
+    "EGL_NV_coverage_sample_resolve",
+    "EGL_NV_cuda_event",
+    "EGL_NV_depth_nonlinear",
+    "EGL_NV_device_cuda",
+    "EGL_NV_native_query",
+    "EGL_NV_post_convert_rounding",
+    "EGL_NV_post_sub_buffer",
+    "EGL_NV_quadruple_buffer",
+    "EGL_NV_robustness_video_memory_purge",
+    "EGL_NV_stream_consumer_eglimage",
+    "EGL_NV_stream_consumer_gltexture_yuv",
+    "EGL_NV_stream_cross_display",
+    "EGL_NV_stream_cross_object",
+    "EGL_NV_stream_cross_partition",
+    "EGL_NV_stream_cross_process",
+    "EGL_NV_stream_cross_system",
+    "EGL_NV_stream_dma",
+    "EGL_NV_stream_fifo_next",
+    "EGL_NV_stream_fifo_synchronous",
+    "EGL_NV_stream_flush",
+    "EGL_NV_stream_frame_limits",
+    "EGL_NV_stream_metadata",
+    "EGL_NV_stream_origin",
+    "EGL_NV_stream_remote",
+    "EGL_NV_stream_reset",
+    "EGL_NV_stream_socket",
+    "EGL_NV_stream_socket_inet",
+    "EGL_NV_stream_socket_unix",
+    "EGL_NV_stream_sync",
+    "EGL_NV_sync",
+    "EGL_NV_system_time",
+    "EGL_NV_triple_buffer",
+    "EGL_TIZEN_image_native_buffer",
+    "EGL_TIZEN_image_native_surface",
+    "EGL_WL_bind_wayland_display",
+    "EGL_WL_create_wayland_buffer_from_image",
+    "GLX_3DFX_multisample",
+    "GLX_AMD_gpu_association",
+    "GLX_ARB_context_flush_control",
+    "GLX_ARB_create_context",
+    "GLX_ARB_create_context_no_error",
+    "GLX_ARB_create_context_profile",
+    "GLX_ARB_create_context_robustness",
+    "GLX_ARB_fbconfig_float",
+    "GLX_ARB_framebuffer_sRGB",
+    "GLX_ARB_get_proc_address",
+    "GLX_ARB_multisample",
+    "GLX_ARB_robustness_application_isolation",
+    "GLX_ARB_robustness_share_group_isolation",
+    "GLX_ARB_vertex_buffer_object",
+    "GLX_ATI_pixel_format_float",
+    "GLX_EXT_buffer_age",
+    "GLX_EXT_context_priority",
+    "GLX_EXT_create_context_es2_profile",
+    "GLX_EXT_create_context_es_profile",
+    "GLX_EXT_fbconfig_packed_float",
+    "GLX_EXT_framebuffer_sRGB",
+    "GLX_EXT_get_drawable_type",
+    "GLX_EXT_import_context",
+    "GLX_EXT_libglvnd",
+    "GLX_EXT_no_config_context",
+    "GLX_EXT_stereo_tree",
+    "GLX_EXT_swap_control",
+    "GLX_EXT_swap_control_tear",
+    "GLX_EXT_texture_from_pixmap",
+    "GLX_EXT_visual_info",
+    "GLX_EXT_visual_rating",
+    "GLX_INTEL_swap_event",
+    "GLX_MESA_agp_offset",
+    "GLX_MESA_copy_sub_buffer",
+    "GLX_MESA_pixmap_colormap",
+    "GLX_MESA_query_renderer",
+    "GLX_MESA_release_buffers",
+    "GLX_MESA_set_3dfx_mode",
+    "GLX_MESA_swap_control",
+    "GLX_NV_copy_buffer",
+    "GLX_NV_copy_image",
+    "GLX_NV_delay_before_swap",
+    "GLX_NV_float_buffer",
+    "GLX_NV_multigpu_context",
+    "GLX_NV_multisample_coverage",
+    "GLX_NV_present_video",
+    "GLX_NV_robustness_video_memory_purge",
+    "GLX_NV_swap_group",
+    "GLX_NV_video_capture",
+    "GLX_NV_video_out",
+    "GLX_OML_swap_method",
+    "GLX_OML_sync_control",
+    "GLX_SGIS_blended_overlay",
+    "GLX_SGIS_multisample",
+    "GLX_SGIS_shared_multisample",
+    "GLX_SGIX_dmbuffer",
+    "GLX_SGIX_fbconfig",
+    "GLX_SGIX_hyperpipe",
+    "GLX_SGIX_pbuffer",
+    "GLX_SGIX_swap_barrier",
+    "GLX_SGIX_swap_group",
+    "GLX_SGIX_video_resize",
+    "GLX_SGIX_video_source",
+    "GLX_SGIX_visual_select_group",
+    "GLX_SGI_cushion",
+    "GLX_SGI_make_current_read",
+    "GLX_SGI_swap_control",
+    "GLX_SGI_video_sync",
+    "GLX_SUN_get_transparent_index",
+    "GL_3DFX_multisample",
+    "GL_3DFX_tbuffer",
+    "GL_3DFX_texture_compression_FXT1",
+    "GL_AMD_blend_minmax_factor",
+    "GL_AMD_compressed_3DC_texture",
+    "GL_AMD_compressed_ATC_texture",
+    "GL_AMD_conservative_depth",
+    "GL_AMD_debug_output",
+    "GL_AMD_depth_clamp_separate",
+    "GL_AMD_draw_buffers_blend",
+    "GL_AMD_framebuffer_multisample_advanced",
+    "GL_AMD_framebuffer_sample_positions",
+    "GL_AMD_gcn_shader",
+    "GL_AMD_gpu_shader_half_float",
+    "GL_AMD_gpu_shader_int16",
+    "GL_AMD_gpu_shader_int64",
+    "GL_AMD_interleaved_elements",
+    "GL_AMD_multi_draw_indirect",
+    "GL_AMD_name_gen_delete",
+    "GL_AMD_occlusion_query_event",
+    "GL_AMD_performance_monitor",
+    "GL_AMD_pinned_memory",
+    "GL_AMD_program_binary_Z400",
+    "GL_AMD_query_buffer_object",
+    "GL_AMD_sample_positions",
+    "GL_AMD_seamless_cubemap_per_texture",
+    "GL_AMD_shader_atomic_counter_ops",
+    "GL_AMD_shader_ballot",
+    "GL_AMD_shader_explicit_vertex_parameter",
+    "GL_AMD_shader_gpu_shader_half_float_fetch",
+    "GL_AMD_shader_image_load_store_lod",
+    "GL_AMD_shader_stencil_export",
+    "GL_AMD_shader_trinary_minmax",
+    "GL_AMD_sparse_texture",
+    "GL_AMD_stencil_operation_extended",
+    "GL_AMD_texture_gather_bias_lod",
+    "GL_AMD_texture_texture4",
+    "GL_AMD_transform_feedback3_lines_triangles",
+    "GL_AMD_transform_feedback4",
+    "GL_AMD_vertex_shader_layer",
+    "GL_AMD_vertex_shader_tessellator",
+    "GL_AMD_vertex_shader_viewport_index",
+    "GL_ANDROID_extension_pack_es31a",
+    "GL_ANGLE_depth_texture",
+    "GL_ANGLE_framebuffer_blit",
+    "GL_ANGLE_framebuffer_multisample",
+    "GL_ANGLE_instanced_arrays",
+    "GL_ANGLE_pack_reverse_row_order",
+    "GL_ANGLE_program_binary",
+    "GL_ANGLE_texture_compression_dxt3",
+    "GL_ANGLE_texture_compression_dxt5",
+    "GL_ANGLE_texture_usage",
+    "GL_ANGLE_translated_shader_source",
+    "GL_APPLE_aux_depth_stencil",
+    "GL_APPLE_client_storage",
+    "GL_APPLE_clip_distance",
+    "GL_APPLE_color_buffer_packed_float",
+    "GL_APPLE_copy_texture_levels",
+    "GL_APPLE_element_array",
+    "GL_APPLE_fence",
+    "GL_APPLE_float_pixels",
+    "GL_APPLE_flush_buffer_range",
+    "GL_APPLE_framebuffer_multisample",
+    "GL_APPLE_object_purgeable",
+    "GL_APPLE_packed_pixels",
+    "GL_APPLE_rgb_422",
+    "GL_APPLE_row_bytes",
+    "GL_APPLE_specular_vector",
+    "GL_APPLE_sync",
+    "GL_APPLE_texture_format_BGRA8888",
+    "GL_APPLE_texture_max_level",
+    "GL_APPLE_texture_packed_float",
+    "GL_APPLE_texture_range",
+    "GL_APPLE_transform_hint",
+    "GL_APPLE_vertex_array_object",
+    "GL_APPLE_vertex_array_range",
+    "GL_APPLE_vertex_program_evaluators",
+    "GL_APPLE_ycbcr_422",
+    "GL_ARB_ES2_compatibility",
+    "GL_ARB_ES3_1_compatibility",
+    "GL_ARB_ES3_2_compatibility",
+    "GL_ARB_ES3_compatibility",
+    "GL_ARB_arrays_of_arrays",
+    "GL_ARB_base_instance",
+    "GL_ARB_bindless_texture",
+    "GL_ARB_blend_func_extended",
+    "GL_ARB_buffer_storage",
+    "GL_ARB_cl_event",
+    "GL_ARB_clear_buffer_object",
+    "GL_ARB_clear_texture",
+    "GL_ARB_clip_control",
+    "GL_ARB_color_buffer_float",
+    "GL_ARB_compatibility",
+    "GL_ARB_compressed_texture_pixel_storage",
+    "GL_ARB_compute_shader",
+    "GL_ARB_compute_variable_group_size",
+    "GL_ARB_conditional_render_inverted",
+    "GL_ARB_conservative_depth",
+    "GL_ARB_copy_buffer",
+    "GL_ARB_copy_image",
+    "GL_ARB_cull_distance",
+    "GL_ARB_debug_output",
+    "GL_ARB_depth_buffer_float",
+    "GL_ARB_depth_clamp",
+    "GL_ARB_depth_texture",
+    "GL_ARB_derivative_control",
+    "GL_ARB_direct_state_access",
+    "GL_ARB_draw_buffers",
+    "GL_ARB_draw_buffers_blend",
+    "GL_ARB_draw_elements_base_vertex",
+    "GL_ARB_draw_indirect",
+    "GL_ARB_draw_instanced",
+    "GL_ARB_enhanced_layouts",
+    "GL_ARB_explicit_attrib_location",
+    "GL_ARB_explicit_uniform_location",
+    "GL_ARB_fragment_coord_conventions",
+    "GL_ARB_fragment_layer_viewport",
+    "GL_ARB_fragment_program",
+    "GL_ARB_fragment_program_shadow",
+    "GL_ARB_fragment_shader",
+    "GL_ARB_fragment_shader_interlock",
+    "GL_ARB_framebuffer_no_attachments",
+    "GL_ARB_framebuffer_object",
+    "GL_ARB_framebuffer_sRGB",
+    "GL_ARB_geometry_shader4",
+    "GL_ARB_get_program_binary",
+    "GL_ARB_get_texture_sub_image",
+    "GL_ARB_gl_spirv",
+    "GL_ARB_gpu_shader5",
+    "GL_ARB_gpu_shader_fp64",
+    "GL_ARB_gpu_shader_int64",
+    "GL_ARB_half_float_pixel",
+    "GL_ARB_half_float_vertex",
+    "GL_ARB_imaging",
+    "GL_ARB_indirect_parameters",
+    "GL_ARB_instanced_arrays",
+    "GL_ARB_internalformat_query",
+    "GL_ARB_internalformat_query2",
+    "GL_ARB_invalidate_subdata",
+    "GL_ARB_map_buffer_alignment",
+    "GL_ARB_map_buffer_range",
+    "GL_ARB_matrix_palette",
+    "GL_ARB_multi_bind",
+    "GL_ARB_multi_draw_indirect",
+    "GL_ARB_multisample",
+    "GL_ARB_multitexture",
+    "GL_ARB_occlusion_query",
+    "GL_ARB_occlusion_query2",
+    "GL_ARB_parallel_shader_compile",
+    "GL_ARB_pipeline_statistics_query",
+    "GL_ARB_pixel_buffer_object",
+    "GL_ARB_point_parameters",
+    "GL_ARB_point_sprite",
+    "GL_ARB_polygon_offset_clamp",
+    "GL_ARB_post_depth_coverage",
+    "GL_ARB_program_interface_query",
+    "GL_ARB_provoking_vertex",
+    "GL_ARB_query_buffer_object",
+    "GL_ARB_robust_buffer_access_behavior",
+    "GL_ARB_robustness",
+    "GL_ARB_robustness_isolation",
+    "GL_ARB_sample_locations",
+    "GL_ARB_sample_shading",
+    "GL_ARB_sampler_objects",
+    "GL_ARB_seamless_cube_map",
+    "GL_ARB_seamless_cubemap_per_texture",
+    "GL_ARB_separate_shader_objects",
+    "GL_ARB_shader_atomic_counter_ops",
+    "GL_ARB_shader_atomic_counters",
+    "GL_ARB_shader_ballot",
+    "GL_ARB_shader_bit_encoding",
+    "GL_ARB_shader_clock",
+    "GL_ARB_shader_draw_parameters",
+    "GL_ARB_shader_group_vote",
+    "GL_ARB_shader_image_load_store",
+    "GL_ARB_shader_image_size",
+    "GL_ARB_shader_objects",
+    "GL_ARB_shader_precision",
+    "GL_ARB_shader_stencil_export",
+    "GL_ARB_shader_storage_buffer_object",
+    "GL_ARB_shader_subroutine",
+    "GL_ARB_shader_texture_image_samples",
+    "GL_ARB_shader_texture_lod",
+    "GL_ARB_shader_viewport_layer_array",
+    "GL_ARB_shading_language_100",
+    "GL_ARB_shading_language_420pack",
+    "GL_ARB_shading_language_include",
+    "GL_ARB_shading_language_packing",
+    "GL_ARB_shadow",
+    "GL_ARB_shadow_ambient",
+    "GL_ARB_sparse_buffer",
+    "GL_ARB_sparse_texture",
+    "GL_ARB_sparse_texture2",
+    "GL_ARB_sparse_texture_clamp",
+    "GL_ARB_spirv_extensions",
+    "GL_ARB_stencil_texturing",
+    "GL_ARB_sync",
+    "GL_ARB_tessellation_shader",
+    "GL_ARB_texture_barrier",
+    "GL_ARB_texture_border_clamp",
+    "GL_ARB_texture_buffer_object",
+    "GL_ARB_texture_buffer_object_rgb32",
+    "GL_ARB_texture_buffer_range",
+    "GL_ARB_texture_compression",
+    "GL_ARB_texture_compression_bptc",
+    "GL_ARB_texture_compression_rgtc",
+    "GL_ARB_texture_cube_map",
+    "GL_ARB_texture_cube_map_array",
+    "GL_ARB_texture_env_add",
+    "GL_ARB_texture_env_combine",
+    "GL_ARB_texture_env_crossbar",
+    "GL_ARB_texture_env_dot3",
+    "GL_ARB_texture_filter_anisotropic",
+    "GL_ARB_texture_filter_minmax",
+    "GL_ARB_texture_float",
+    "GL_ARB_texture_gather",
+    "GL_ARB_texture_mirror_clamp_to_edge",
+    "GL_ARB_texture_mirrored_repeat",
+    "GL_ARB_texture_multisample",
+    "GL_ARB_texture_non_power_of_two",
+    "GL_ARB_texture_query_levels",
+    "GL_ARB_texture_query_lod",
+    "GL_ARB_texture_rectangle",
+    "GL_ARB_texture_rg",
+    "GL_ARB_texture_rgb10_a2ui",
+    "GL_ARB_texture_stencil8",
+    "GL_ARB_texture_storage",
+    "GL_ARB_texture_storage_multisample",
+    "GL_ARB_texture_swizzle",
+    "GL_ARB_texture_view",
+    "GL_ARB_timer_query",
+    "GL_ARB_transform_feedback2",
+    "GL_ARB_transform_feedback3",
+    "GL_ARB_transform_feedback_instanced",
+    "GL_ARB_transform_feedback_overflow_query",
+    "GL_ARB_transpose_matrix",
+    "GL_ARB_uniform_buffer_object",
+    "GL_ARB_vertex_array_bgra",
+    "GL_ARB_vertex_array_object",
+    "GL_ARB_vertex_attrib_64bit",
+    "GL_ARB_vertex_attrib_binding",
+    "GL_ARB_vertex_blend",
+    "GL_ARB_vertex_buffer_object",
+    "GL_ARB_vertex_program",
+    "GL_ARB_vertex_shader",
+    "GL_ARB_vertex_type_10f_11f_11f_rev",
+    "GL_ARB_vertex_type_2_10_10_10_rev",
+    "GL_ARB_viewport_array",
+    "GL_ARB_window_pos",
+    "GL_ARM_mali_program_binary",
+    "GL_ARM_mali_shader_binary",
+    "GL_ARM_rgba8",
+    "GL_ARM_shader_framebuffer_fetch",
+    "GL_ARM_shader_framebuffer_fetch_depth_stencil",
+    "GL_ARM_texture_unnormalized_coordinates",
+    "GL_ATI_blend_equation_separate",
+    "GL_ATI_draw_buffers",
+    "GL_ATI_element_array",
+    "GL_ATI_envmap_bumpmap",
+    "GL_ATI_fragment_shader",
+    "GL_ATI_map_object_buffer",
+    "GL_ATI_meminfo",
+    "GL_ATI_pixel_format_float",
+    "GL_ATI_pn_triangles",
+    "GL_ATI_separate_stencil",
+    "GL_ATI_text_fragment_shader",
+    "GL_ATI_texture_compression_3dc",
+    "GL_ATI_texture_env_combine3",
+    "GL_ATI_texture_float",
+    "GL_ATI_texture_mirror_once",
+    "GL_ATI_vertex_array_object",
+    "GL_ATI_vertex_attrib_array_object",
+    "GL_ATI_vertex_streams",
+    "GL_DMP_program_binary",
+    "GL_DMP_shader_binary",
+    "GL_EXT_422_pixels",
+    "GL_EXT_EGL_image_array",
+    "GL_EXT_EGL_image_storage",
+    "GL_EXT_EGL_image_storage_compression",
+    "GL_EXT_EGL_sync",
+    "GL_EXT_YUV_target",
+    "GL_EXT_abgr",
+    "GL_EXT_base_instance",
+    "GL_EXT_bgra",
+    "GL_EXT_bindable_uniform",
+    "GL_EXT_blend_color",
+    "GL_EXT_blend_equation_separate",
+    "GL_EXT_blend_func_extended",
+    "GL_EXT_blend_func_separate",
+    "GL_EXT_blend_logic_op",
+    "GL_EXT_blend_minmax",
+    "GL_EXT_blend_subtract",
+    "GL_EXT_buffer_storage",
+    "GL_EXT_clear_texture",
+    "GL_EXT_clip_control",
+    "GL_EXT_clip_cull_distance",
+    "GL_EXT_clip_volume_hint",
+    "GL_EXT_cmyka",
+    "GL_EXT_color_buffer_float",
+    "GL_EXT_color_buffer_half_float",
+    "GL_EXT_color_subtable",
+    "GL_EXT_compiled_vertex_array",
+    "GL_EXT_compressed_ETC1_RGB8_sub_texture",
+    "GL_EXT_conservative_depth",
+    "GL_EXT_convolution",
+    "GL_EXT_coordinate_frame",
+    "GL_EXT_copy_image",
+    "GL_EXT_copy_texture",
+    "GL_EXT_cull_vertex",
+    "GL_EXT_debug_label",
+    "GL_EXT_debug_marker",
+    "GL_EXT_demote_to_helper_invocation",
+    "GL_EXT_depth_bounds_test",
+    "GL_EXT_depth_clamp",
+    "GL_EXT_direct_state_access",
+    "GL_EXT_discard_framebuffer",
+    "GL_EXT_disjoint_timer_query",
+    "GL_EXT_draw_buffers",
+    "GL_EXT_draw_buffers2",
+    "GL_EXT_draw_buffers_indexed",
+    "GL_EXT_draw_elements_base_vertex",
+    "GL_EXT_draw_instanced",
+    "GL_EXT_draw_range_elements",
+    "GL_EXT_draw_transform_feedback",
+    "GL_EXT_external_buffer",
+    "GL_EXT_float_blend",
+    "GL_EXT_fog_coord",
+    "GL_EXT_frag_depth",
+    "GL_EXT_fragment_shading_rate",
+    "GL_EXT_framebuffer_blit",
+    "GL_EXT_framebuffer_multisample",
+    "GL_EXT_framebuffer_multisample_blit_scaled",
+    "GL_EXT_framebuffer_object",
+    "GL_EXT_framebuffer_sRGB",
+    "GL_EXT_geometry_point_size",
+    "GL_EXT_geometry_shader",
+    "GL_EXT_geometry_shader4",
+    "GL_EXT_gpu_program_parameters",
+    "GL_EXT_gpu_shader4",
+    "GL_EXT_gpu_shader5",
+    "GL_EXT_histogram",
+    "GL_EXT_image_load_formatted",
+    "GL_EXT_index_array_formats",
+    "GL_EXT_index_func",
+    "GL_EXT_index_material",
+    "GL_EXT_index_texture",
+    "GL_EXT_instanced_arrays",
+    "GL_EXT_light_texture",
+    "GL_EXT_map_buffer_range",
+    "GL_EXT_memory_object",
+    "GL_EXT_memory_object_fd",
+    "GL_EXT_memory_object_win32",
+    "GL_EXT_misc_attribute",
+    "GL_EXT_multi_draw_arrays",
+    "GL_EXT_multi_draw_indirect",
+    "GL_EXT_multisample",
+    "GL_EXT_multisampled_compatibility",
+    "GL_EXT_multisampled_render_to_texture",
+    "GL_EXT_multisampled_render_to_texture2",
+    "GL_EXT_multiview_draw_buffers",
+    "GL_EXT_multiview_tessellation_geometry_shader",
+    "GL_EXT_multiview_texture_multisample",
+    "GL_EXT_multiview_timer_query",
+    "GL_EXT_occlusion_query_boolean",
+    "GL_EXT_packed_depth_stencil",
+    "GL_EXT_packed_float",
+    "GL_EXT_packed_pixels",
+    "GL_EXT_paletted_texture",
+    "GL_EXT_pixel_buffer_object",
+    "GL_EXT_pixel_transform",
+    "GL_EXT_pixel_transform_color_table",
+    "GL_EXT_point_parameters",
+    "GL_EXT_polygon_offset",
+    "GL_EXT_polygon_offset_clamp",
+    "GL_EXT_post_depth_coverage",
+    "GL_EXT_primitive_bounding_box",
+    "GL_EXT_protected_textures",
+    "GL_EXT_provoking_vertex",
+    "GL_EXT_pvrtc_sRGB",
+    "GL_EXT_raster_multisample",
+    "GL_EXT_read_format_bgra",
+    "GL_EXT_render_snorm",
+    "GL_EXT_rescale_normal",
+    "GL_EXT_robustness",
+    "GL_EXT_sRGB",
+    "GL_EXT_sRGB_write_control",
+    "GL_EXT_secondary_color",
+    "GL_EXT_semaphore",
+    "GL_EXT_semaphore_fd",
+    "GL_EXT_semaphore_win32",
+    "GL_EXT_separate_depth_stencil",
+    "GL_EXT_separate_shader_objects",
+    "GL_EXT_separate_specular_color",
+    "GL_EXT_shader_framebuffer_fetch",
+    "GL_EXT_shader_framebuffer_fetch_non_coherent",
+    "GL_EXT_shader_group_vote",
+    "GL_EXT_shader_image_load_formatted",
+    "GL_EXT_shader_image_load_store",
+    "GL_EXT_shader_implicit_conversions",
+    "GL_EXT_shader_integer_mix",
+    "GL_EXT_shader_io_blocks",
+    "GL_EXT_shader_non_constant_global_initializers",
+    "GL_EXT_shader_pixel_local_storage",
+    "GL_EXT_shader_pixel_local_storage2",
+    "GL_EXT_shader_samples_identical",
+    "GL_EXT_shader_texture_lod",
+    "GL_EXT_shadow_funcs",
+    "GL_EXT_shadow_samplers",
+    "GL_EXT_shared_texture_palette",
+    "GL_EXT_sparse_texture",
+    "GL_EXT_sparse_texture2",
+    "GL_EXT_stencil_clear_tag",
+    "GL_EXT_stencil_two_side",
+    "GL_EXT_stencil_wrap",
+    "GL_EXT_subtexture",
+    "GL_EXT_tessellation_point_size",
+    "GL_EXT_tessellation_shader",
+    "GL_EXT_texture",
+    "GL_EXT_texture3D",
+    "GL_EXT_texture_array",
+    "GL_EXT_texture_border_clamp",
+    "GL_EXT_texture_buffer",
+    "GL_EXT_texture_buffer_object",
+    "GL_EXT_texture_compression_astc_decode_mode",
+    "GL_EXT_texture_compression_bptc",
+    "GL_EXT_texture_compression_dxt1",
+    "GL_EXT_texture_compression_latc",
+    "GL_EXT_texture_compression_rgtc",
+    "GL_EXT_texture_compression_s3tc",
+    "GL_EXT_texture_compression_s3tc_srgb",
+    "GL_EXT_texture_cube_map",
+    "GL_EXT_texture_cube_map_array",
+    "GL_EXT_texture_edge_clamp",
+    "GL_EXT_texture_env_add",
+    "GL_EXT_texture_env_combine",
+    "GL_EXT_texture_env_dot3",
+    "GL_EXT_texture_filter_anisotropic",
+    "GL_EXT_texture_filter_minmax",
+    "GL_EXT_texture_format_BGRA8888",
+    "GL_EXT_texture_format_sRGB_override",
+    "GL_EXT_texture_integer",
+    "GL_EXT_texture_lod",
+    "GL_EXT_texture_lod_bias",
+    "GL_EXT_texture_mirror_clamp",
+    "GL_EXT_texture_mirror_clamp_to_edge",
+    "GL_EXT_texture_norm16",
+    "GL_EXT_texture_object",
+    "GL_EXT_texture_perturb_normal",
+    "GL_EXT_texture_query_lod",
+    "GL_EXT_texture_rectangle",
+    "GL_EXT_texture_rg",
+    "GL_EXT_texture_sRGB",
+    "GL_EXT_texture_sRGB_R8",
+    "GL_EXT_texture_sRGB_RG8",
+    "GL_EXT_texture_sRGB_decode",
+    "GL_EXT_texture_shadow_lod",
+    "GL_EXT_texture_shared_exponent",
+    "GL_EXT_texture_snorm",
+    "GL_EXT_texture_storage",
+    "GL_EXT_texture_storage_compression",
+    "GL_EXT_texture_swizzle",
+    "GL_EXT_texture_type_2_10_10_10_REV",
+    "GL_EXT_texture_view",
+    "GL_EXT_timer_query",
+    "GL_EXT_transform_feedback",
+    "GL_EXT_unpack_subimage",
+    "GL_EXT_vertex_array",
+    "GL_EXT_vertex_array_bgra",
+    "GL_EXT_vertex_attrib_64bit",
+    "GL_EXT_vertex_shader",
+    "GL_EXT_vertex_weighting",
+    "GL_EXT_win32_keyed_mutex",
+    "GL_EXT_window_rectangles",
+    "GL_EXT_x11_sync_object",
+    "GL_FJ_shader_binary_GCCSO",
+    "GL_GREMEDY_frame_terminator",
+    "GL_GREMEDY_string_marker",
+    "GL_HP_convolution_border_modes",
+    "GL_HP_image_transform",
+    "GL_HP_occlusion_test",
+    "GL_HP_texture_lighting",
+    "GL_IBM_cull_vertex",
+    "GL_IBM_multimode_draw_arrays",
+    "GL_IBM_pixel_filter_hint",
+    "GL_IBM_rasterpos_clip",
+    "GL_IBM_static_data",
+    "GL_IBM_texture_clamp_nodraw",
+    "GL_IBM_texture_mirrored_repeat",
+    "GL_IBM_vertex_array_lists",
+    "GL_IMG_bindless_texture",
+    "GL_IMG_framebuffer_downsample",
+    "GL_IMG_multisampled_render_to_texture",
+    "GL_IMG_program_binary",
+    "GL_IMG_read_format",
+    "GL_IMG_shader_binary",
+    "GL_IMG_texture_compression_pvrtc",
+    "GL_IMG_texture_compression_pvrtc2",
+    "GL_IMG_texture_filter_cubic",
+    "GL_INGR_blend_func_separate",
+    "GL_INGR_color_clamp",
+    "GL_INGR_interlace_read",
+    "GL_INTEL_blackhole_render",
+    "GL_INTEL_conservative_rasterization",
+    "GL_INTEL_fragment_shader_ordering",
+    "GL_INTEL_framebuffer_CMAA",
+    "GL_INTEL_map_texture",
+    "GL_INTEL_parallel_arrays",
+    "GL_INTEL_performance_query",
+    "GL_INTEL_shader_atomic_float_minmax",
+    "GL_INTEL_shader_integer_functions2",
+    "GL_KHR_blend_equation_advanced",
+    "GL_KHR_blend_equation_advanced_coherent",
+    "GL_KHR_context_flush_control",
+    "GL_KHR_debug",
+    "GL_KHR_no_error",
+    "GL_KHR_parallel_shader_compile",
+    "GL_KHR_robust_buffer_access_behavior",
+    "GL_KHR_robustness",
+    "GL_KHR_shader_subgroup",
+    "GL_KHR_texture_compression_astc_hdr",
+    "GL_KHR_texture_compression_astc_ldr",
+    "GL_KHR_texture_compression_astc_sliced_3d",
+    "GL_MESAX_texture_stack",
+    "GL_MESA_bgra",
+    "GL_MESA_framebuffer_flip_x",
+    "GL_MESA_framebuffer_flip_y",
+    "GL_MESA_framebuffer_swap_xy",
+    "GL_MESA_pack_invert",
+    "GL_MESA_program_binary_formats",
+    "GL_MESA_resize_buffers",
+    "GL_MESA_shader_integer_functions",
+    "GL_MESA_texture_signed_rgba",
+    "GL_MESA_tile_raster_order",
+    "GL_MESA_window_pos",
+    "GL_MESA_ycbcr_texture",
+    "GL_NVX_blend_equation_advanced_multi_draw_buffers",
+    "GL_NVX_conditional_render",
+    "GL_NVX_gpu_memory_info",
+    "GL_NVX_gpu_multicast2",
+    "GL_NVX_linked_gpu_multicast",
+    "GL_NVX_progress_fence",
+    "GL_NV_ES1_1_compatibility",
+    "GL_NV_alpha_to_coverage_dither_control",
+    "GL_NV_bindless_multi_draw_indirect",
+    "GL_NV_bindless_multi_draw_indirect_count",
+    "GL_NV_bindless_texture",
+    "GL_NV_blend_equation_advanced",
+    "GL_NV_blend_equation_advanced_coherent",
+    "GL_NV_blend_minmax_factor",
+    "GL_NV_blend_square",
+    "GL_NV_clip_space_w_scaling",
+    "GL_NV_command_list",
+    "GL_NV_compute_program5",
+    "GL_NV_compute_shader_derivatives",
+    "GL_NV_conditional_render",
+    "GL_NV_conservative_raster",
+    "GL_NV_conservative_raster_dilate",
+    "GL_NV_conservative_raster_pre_snap",
+    "GL_NV_conservative_raster_pre_snap_triangles",
+    "GL_NV_conservative_raster_underestimation",
+    "GL_NV_copy_buffer",
+    "GL_NV_copy_depth_to_color",
+    "GL_NV_copy_image",
+    "GL_NV_coverage_sample",
+    "GL_NV_deep_texture3D",
+    "GL_NV_depth_buffer_float",
+    "GL_NV_depth_clamp",
+    "GL_NV_depth_nonlinear",
+    "GL_NV_draw_buffers",
+    "GL_NV_draw_instanced",
+    "GL_NV_draw_texture",
+    "GL_NV_draw_vulkan_image",
+    "GL_NV_evaluators",
+    "GL_NV_explicit_attrib_location",
+    "GL_NV_explicit_multisample",
+    "GL_NV_fbo_color_attachments",
+    "GL_NV_fence",
+    "GL_NV_fill_rectangle",
+    "GL_NV_float_buffer",
+    "GL_NV_fog_distance",
+    "GL_NV_fragment_coverage_to_color",
+    "GL_NV_fragment_program",
+    "GL_NV_fragment_program2",
+    "GL_NV_fragment_program4",
+    "GL_NV_fragment_program_option",
+    "GL_NV_fragment_shader_barycentric",
+    "GL_NV_fragment_shader_interlock",
+    "GL_NV_framebuffer_blit",
+    "GL_NV_framebuffer_mixed_samples",
+    "GL_NV_framebuffer_multisample",
+    "GL_NV_framebuffer_multisample_coverage",
+    "GL_NV_generate_mipmap_sRGB",
+    "GL_NV_geometry_program4",
+    "GL_NV_geometry_shader4",
+    "GL_NV_geometry_shader_passthrough",
+    "GL_NV_gpu_multicast",
+    "GL_NV_gpu_program4",
+    "GL_NV_gpu_program5",
+    "GL_NV_gpu_program5_mem_extended",
+    "GL_NV_gpu_shader5",
+    "GL_NV_half_float",
+    "GL_NV_image_formats",
+    "GL_NV_instanced_arrays",
+    "GL_NV_internalformat_sample_query",
+    "GL_NV_light_max_exponent",
+    "GL_NV_memory_attachment",
+    "GL_NV_memory_object_sparse",
+    "GL_NV_mesh_shader",
+    "GL_NV_multisample_coverage",
+    "GL_NV_multisample_filter_hint",
+    "GL_NV_non_square_matrices",
+    "GL_NV_occlusion_query",
+    "GL_NV_pack_subimage",
+    "GL_NV_packed_depth_stencil",
+    "GL_NV_parameter_buffer_object",
+    "GL_NV_parameter_buffer_object2",
+    "GL_NV_path_rendering",
+    "GL_NV_path_rendering_shared_edge",
+    "GL_NV_pixel_buffer_object",
+    "GL_NV_pixel_data_range",
+    "GL_NV_point_sprite",
+    "GL_NV_polygon_mode",
+    "GL_NV_present_video",
+    "GL_NV_primitive_restart",
+    "GL_NV_primitive_shading_rate",
+    "GL_NV_query_resource",
+    "GL_NV_query_resource_tag",
+    "GL_NV_read_buffer",
+    "GL_NV_read_buffer_front",
+    "GL_NV_read_depth",
+    "GL_NV_read_depth_stencil",
+    "GL_NV_read_stencil",
+    "GL_NV_register_combiners",
+    "GL_NV_register_combiners2",
+    "GL_NV_representative_fragment_test",
+    "GL_NV_robustness_video_memory_purge",
+    "GL_NV_sRGB_formats",
+    "GL_NV_sample_locations",
+    "GL_NV_sample_mask_override_coverage",
+    "GL_NV_scissor_exclusive",
+    "GL_NV_shader_atomic_counters",
+    "GL_NV_shader_atomic_float",
+    "GL_NV_shader_atomic_float64",
+    "GL_NV_shader_atomic_fp16_vector",
+    "GL_NV_shader_atomic_int64",
+    "GL_NV_shader_buffer_load",
+    "GL_NV_shader_buffer_store",
+    "GL_NV_shader_noperspective_interpolation",
+    "GL_NV_shader_storage_buffer_object",
+    "GL_NV_shader_subgroup_partitioned",
+    "GL_NV_shader_texture_footprint",
+    "GL_NV_shader_thread_group",
+    "GL_NV_shader_thread_shuffle",
+    "GL_NV_shading_rate_image",
+    "GL_NV_shadow_samplers_array",
+    "GL_NV_shadow_samplers_cube",
+    "GL_NV_stereo_view_rendering",
+    "GL_NV_tessellation_program5",
+    "GL_NV_texgen_emboss",
+    "GL_NV_texgen_reflection",
+    "GL_NV_texture_barrier",
+    "GL_NV_texture_border_clamp",
+    "GL_NV_texture_compression_s3tc_update",
+    "GL_NV_texture_compression_vtc",
+    "GL_NV_texture_env_combine4",
+    "GL_NV_texture_expand_normal",
+    "GL_NV_texture_multisample",
+    "GL_NV_texture_npot_2D_mipmap",
+    "GL_NV_texture_rectangle",
+    "GL_NV_texture_rectangle_compressed",
+    "GL_NV_texture_shader",
+    "GL_NV_texture_shader2",
+    "GL_NV_texture_shader3",
+    "GL_NV_timeline_semaphore",
+    "GL_NV_transform_feedback",
+    "GL_NV_transform_feedback2",
+    "GL_NV_uniform_buffer_unified_memory",
+    "GL_NV_vdpau_interop",
+    "GL_NV_vdpau_interop2",
+    "GL_NV_vertex_array_range",
+    "GL_NV_vertex_array_range2",
+    "GL_NV_vertex_attrib_integer_64bit",
+    "GL_NV_vertex_buffer_unified_memory",
+    "GL_NV_vertex_program",
+    "GL_NV_vertex_program1_1",
+    "GL_NV_vertex_program2",
+    "GL_NV_vertex_program2_option",
+    "GL_NV_vertex_program3",
+    "GL_NV_vertex_program4",
+    "GL_NV_video_capture",
+    "GL_NV_viewport_array",
+    "GL_NV_viewport_array2",
+    "GL_NV_viewport_swizzle",
+    "GL_OES_EGL_image",
+    "GL_OES_EGL_image_external",
+    "GL_OES_EGL_image_external_essl3",
+    "GL_OES_EGL_sync",
+    "GL_OES_blend_equation_separate",
+    "GL_OES_blend_func_separate",
+    "GL_OES_blend_subtract",
+    "GL_OES_byte_coordinates",
+    "GL_OES_compressed_ETC1_RGB8_sub_texture",
+    "GL_OES_compressed_ETC1_RGB8_texture",
+    "GL_OES_compressed_paletted_texture",
+    "GL_OES_copy_image",
+    "GL_OES_depth24",
+    "GL_OES_depth32",
+    "GL_OES_depth_texture",
+    "GL_OES_depth_texture_cube_map",
+    "GL_OES_draw_buffers_indexed",
+    "GL_OES_draw_elements_base_vertex",
+    "GL_OES_draw_texture",
+    "GL_OES_element_index_uint",
+    "GL_OES_fbo_render_mipmap",
+    "GL_OES_fixed_point",
+    "GL_OES_fragment_precision_high",
+    "GL_OES_framebuffer_object",
+    "GL_OES_geometry_point_size",
+    "GL_OES_geometry_shader",
+    "GL_OES_get_program_binary",
+    "GL_OES_gpu_shader5",
+    "GL_OES_mapbuffer",
+    "GL_OES_packed_depth_stencil",
+    "GL_OES_point_size_array",
+    "GL_OES_point_sprite",
+    "GL_OES_primitive_bounding_box",
+    "GL_OES_query_matrix",
+    "GL_OES_read_format",
+    "GL_OES_required_internalformat",
+    "GL_OES_rgb8_rgba8",
+    "GL_OES_sample_shading",
+    "GL_OES_sample_variables",
+    "GL_OES_shader_image_atomic",
+    "GL_OES_shader_io_blocks",
+    "GL_OES_shader_multisample_interpolation",
+    "GL_OES_single_precision",
+    "GL_OES_standard_derivatives",
+    "GL_OES_stencil1",
+    "GL_OES_stencil4",
+    "GL_OES_stencil8",
+    "GL_OES_stencil_wrap",
+    "GL_OES_surfaceless_context",
+    "GL_OES_tessellation_point_size",
+    "GL_OES_tessellation_shader",
+    "GL_OES_texture_3D",
+    "GL_OES_texture_border_clamp",
+    "GL_OES_texture_buffer",
+    "GL_OES_texture_compression_astc",
+    "GL_OES_texture_cube_map",
+    "GL_OES_texture_cube_map_array",
+    "GL_OES_texture_env_crossbar",
+    "GL_OES_texture_float",
+    "GL_OES_texture_float_linear",
+    "GL_OES_texture_half_float",
+    "GL_OES_texture_half_float_linear",
+    "GL_OES_texture_mirrored_repeat",
+    "GL_OES_texture_npot",
+    "GL_OES_texture_stencil8",
+    "GL_OES_texture_storage_multisample_2d_array",
+    "GL_OES_texture_view",
+    "GL_OES_vertex_array_object",
+    "GL_OES_vertex_half_float",
+    "GL_OES_vertex_type_10_10_10_2",
+    "GL_OES_viewport_array",
+    "GL_OML_interlace",
+    "GL_OML_resample",
+    "GL_OML_subsample",
+    "GL_OVR_multiview",
+    "GL_OVR_multiview2",
+    "GL_OVR_multiview_multisampled_render_to_texture",
+    "GL_QCOM_YUV_texture_gather",
+    "GL_QCOM_alpha_test",
+    "GL_QCOM_binning_control",
+    "GL_QCOM_driver_control",
+    "GL_QCOM_extended_get",
+    "GL_QCOM_extended_get2",
+    "GL_QCOM_frame_extrapolation",
+    "GL_QCOM_framebuffer_foveated",
+    "GL_QCOM_motion_estimation",
+    "GL_QCOM_perfmon_global_mode",
+    "GL_QCOM_render_shared_exponent",
+    "GL_QCOM_shader_framebuffer_fetch_noncoherent",
+    "GL_QCOM_shader_framebuffer_fetch_rate",
+    "GL_QCOM_shading_rate",
+    "GL_QCOM_texture_foveated",
+    "GL_QCOM_texture_foveated2",
+    "GL_QCOM_texture_foveated_subsampled_layout",
+    "GL_QCOM_tiled_rendering",
+    "GL_QCOM_writeonly_rendering",
+    "GL_REND_screen_coordinates",
+    "GL_S3_s3tc",
+    "GL_SGIS_detail_texture",
+    "GL_SGIS_fog_function",
+    "GL_SGIS_generate_mipmap",
+    "GL_SGIS_multisample",
+    "GL_SGIS_pixel_texture",
+    "GL_SGIS_point_line_texgen",
+    "GL_SGIS_point_parameters",
+    "GL_SGIS_sharpen_texture",
+    "GL_SGIS_texture4D",
+    "GL_SGIS_texture_border_clamp",
+    "GL_SGIS_texture_color_mask",
+    "GL_SGIS_texture_edge_clamp",
+    "GL_SGIS_texture_filter4",
+    "GL_SGIS_texture_lod",
+    "GL_SGIS_texture_select",
+    "GL_SGIX_async",
+    "GL_SGIX_async_histogram",
+    "GL_SGIX_async_pixel",
+    "GL_SGIX_blend_alpha_minmax",
+    "GL_SGIX_calligraphic_fragment",
+    "GL_SGIX_clipmap",
+    "GL_SGIX_convolution_accuracy",
+    "GL_SGIX_depth_pass_instrument",
+    "GL_SGIX_depth_texture",
+    "GL_SGIX_flush_raster",
+    "GL_SGIX_fog_offset",
+    "GL_SGIX_fragment_lighting",
+    "GL_SGIX_framezoom",
+    "GL_SGIX_igloo_interface",
+    "GL_SGIX_instruments",
+    "GL_SGIX_interlace",
+    "GL_SGIX_ir_instrument1",
+    "GL_SGIX_list_priority",
+    "GL_SGIX_pixel_texture",
+    "GL_SGIX_pixel_tiles",
+    "GL_SGIX_polynomial_ffd",
+    "GL_SGIX_reference_plane",
+    "GL_SGIX_resample",
+    "GL_SGIX_scalebias_hint",
+    "GL_SGIX_shadow",
+    "GL_SGIX_shadow_ambient",
+    "GL_SGIX_sprite",
+    "GL_SGIX_subsample",
+    "GL_SGIX_tag_sample_buffer",
+    "GL_SGIX_texture_add_env",
+    "GL_SGIX_texture_coordinate_clamp",
+    "GL_SGIX_texture_lod_bias",
+    "GL_SGIX_texture_multi_buffer",
+    "GL_SGIX_texture_range",
+    "GL_SGIX_texture_scale_bias",
+    "GL_SGIX_vertex_preclip",
+    "GL_SGIX_vertex_preclip_hint",
+    "GL_SGIX_ycrcb",
+    "GL_SGIX_ycrcb_subsample",
+    "GL_SGIX_ycrcba",
+    "GL_SGI_color_matrix",
+    "GL_SGI_color_table",
+    "GL_SGI_texture_color_table",
+    "GL_SUNX_constant_data",
+    "GL_SUN_convolution_border_modes",
+    "GL_SUN_global_alpha",
+    "GL_SUN_mesh_array",
+    "GL_SUN_multi_draw_arrays",
+    "GL_SUN_slice_accum",
+    "GL_SUN_triangle_list",
+    "GL_SUN_vertex",
+    "GL_VIV_shader_binary",
+    "GL_WEBGL_compressed_texture_astc",
+    "GL_WEBGL_compressed_texture_etc",
+    "GL_WEBGL_compressed_texture_etc1",
+    "GL_WEBGL_compressed_texture_s3tc",
+    "GL_WEBGL_compressed_texture_s3tc_srgb",
+    "GL_WEBGL_debug_renderer_info",
+    "GL_WEBGL_debug_shaders",
+    "GL_WEBGL_depth_texture",
+    "GL_WEBGL_draw_buffers",
+    "GL_WEBGL_lose_context",
+    "GL_WEBGL_multi_draw",
+    "GL_WIN_phong_shading",
+    "GL_WIN_specular_fog",
+    "WGL_3DFX_multisample",
+    "WGL_AMD_gpu_association",
+    "WGL_ARB_buffer_region",
+    "WGL_ARB_context_flush_control",
+    "WGL_ARB_create_context",
+    "WGL_ARB_create_context_no_error",
+    "WGL_ARB_create_context_profile",
+    "WGL_ARB_create_context_robustness",
+    "WGL_ARB_extensions_string",
+    "WGL_ARB_framebuffer_sRGB",
+    "WGL_ARB_make_current_read",
+    "WGL_ARB_multisample",
+    "WGL_ARB_pbuffer",
+    "WGL_ARB_pixel_format",
+    "WGL_ARB_pixel_format_float",
+    "WGL_ARB_render_texture",
+    "WGL_ARB_robustness_application_isolation",
+    "WGL_ARB_robustness_share_group_isolation",
+    "WGL_ATI_pixel_format_float",
+    "WGL_EXT_colorspace",
+    "WGL_EXT_create_context_es2_profile",
+    "WGL_EXT_create_context_es_profile",
+    "WGL_EXT_depth_float",
+    "WGL_EXT_extensions_string",
+    "WGL_EXT_framebuffer_sRGB",
+    "WGL_EXT_make_current_read",
+    "WGL_EXT_multisample",
+    "WGL_EXT_pbuffer",
+    "WGL_EXT_pixel_format",
+    "WGL_EXT_pixel_format_packed_float",
+    "WGL_EXT_swap_control",
+    "WGL_EXT_swap_control_tear",
+    "WGL_I3D_genlock",
+    "WGL_I3D_swap_frame_lock",
+    "WGL_NV_DX_interop",
+    "WGL_NV_DX_interop2",
+    "WGL_NV_copy_image",
+    "WGL_NV_delay_before_swap",
+    "WGL_NV_float_buffer",
+    "WGL_NV_gpu_affinity",
+    "WGL_NV_multisample_coverage",
+    "WGL_NV_present_video",
+    "WGL_NV_render_depth_texture",
+    "WGL_NV_render_texture_rectangle",
+    "WGL_NV_swap_group",
+    "WGL_NV_vertex_array_range",
+    "WGL_NV_video_capture",
+    "WGL_NV_video_output",
+    "WGL_OML_sync_control",
+  };
+
+  static_assert(sizeof(THE_KNOWN_EXTENSIONS) / sizeof(THE_KNOWN_EXTENSIONS[0]) == ExtensionBitset::THE_NB_KNOWN,
+                "ExtensionBitset::THE_NB_KNOWN should match the registry size");
+
+  //! Compare two names in strcmp() order.
+  static constexpr bool isLessName(const char* theA, const char* theB)
+  {
+    return *theA != *theB ? (uint8_t)*theA < (uint8_t)*theB : (*theA != '\0' && isLessName(theA + 1, theB + 1));
+  }
+
+  //! Check that registry range [theFrom, theTo] is sorted; recursion splits the range to keep depth low.
+  static constexpr bool isSortedRange(int theFrom, int theTo)
+  {
+    return theTo - theFrom < 2
+         ? (theTo == theFrom || isLessName(THE_KNOWN_EXTENSIONS[theFrom], THE_KNOWN_EXTENSIONS[theTo]))
+         : (isSortedRange(theFrom, (theFrom + theTo) / 2) && isSortedRange((theFrom + theTo) / 2, theTo));
+  }
+
+  static_assert(isSortedRange(0, ExtensionBitset::THE_NB_KNOWN - 1),
+                "Registry of known extensions should be sorted and have no duplicates");
+
+  //! Return seeded FNV-1a hash of the name.
+  static uint32_t hashName(const char* theName, size_t theLen, uint32_t theSeed)
+  {
+    uint32_t aHash = 2166136261u ^ (theSeed * 0x9E3779B9u);
+    for (size_t aCharIter = 0; aCharIter < theLen; ++aCharIter)
+    {
+      aHash ^= (uint8_t)theName[aCharIter];
+      aHash *= 16777619u;
+    }
+    // final avalanche to spread low bits used for modulo
+    aHash ^= aHash >> 15;
+    aHash *= 0x2C1B3C6Du;
+    aHash ^= aHash >> 12;
+    return aHash;
+  }
+
+  //! Minimal perfect hash over the registry (hash and displace).
+  //! Name is mapped to bucket by unseeded hash, then to slot by hash seeded with displacement of the bucket.
+  //! Bucket which could not be placed within displacement range falls back to binary search in sorted registry.
+  struct KnownExtensionsIndex
+  {
+    static const uint16_t THE_DISP_SORTED = 0xFFFF; //!< displacement of bucket using binary search
+
+    std::vector<uint16_t> Displacements; //!< displacement per bucket
+    std::vector<uint16_t> Slots;         //!< registry index per slot
+    uint32_t              RegistryId = 0;
+
+    KnownExtensionsIndex()
+    {
+      const int aNbKnown   = ExtensionBitset::THE_NB_KNOWN;
+      const int aNbBuckets = (aNbKnown + 3) / 4;
+      std::vector<std::vector<int>> aBuckets(aNbBuckets);
+      for (int anExtIter = 0; anExtIter < aNbKnown; ++anExtIter)
+      {
+        const char* aName = THE_KNOWN_EXTENSIONS[anExtIter];
+        const size_t aLen = strlen(aName);
+        aBuckets[hashName(aName, aLen, 0) % aNbBuckets].push_back(anExtIter);
+        RegistryId = hashName(aName, aLen, RegistryId);
+      }
+
+      // place largest buckets first, while most slots are free
+      std::vector<int> anOrder(aNbBuckets);
+      for (int aBucketIter = 0; aBucketIter < aNbBuckets; ++aBucketIter)
+        anOrder[aBucketIter] = aBucketIter;
+      std::stable_sort(anOrder.begin(), anOrder.end(), [&aBuckets](int theA, int theB)
+                       { return aBuckets[theA].size() > aBuckets[theB].size(); });
+
+      Displacements.assign(aNbBuckets, 0);
+      std::vector<bool> anIsUsed(aNbKnown, false);
+      Slots.assign(aNbKnown, 0);
+      std::vector<int> aBucketSlots;
+      for (int aBucket : anOrder)
+      {
+        const std::vector<int>& anExts = aBuckets[aBucket];
+        if (!anExts.empty())
+          Displacements[aBucket] = THE_DISP_SORTED;
+        for (uint32_t aDisp = 1; aDisp < THE_DISP_SORTED && !anExts.empty(); ++aDisp)
+        {
+          aBucketSlots.clear();
+          for (int anExt : anExts)
+          {
+            const char* aName = THE_KNOWN_EXTENSIONS[anExt];
+            const int aSlot = int(hashName(aName, strlen(aName), aDisp) % aNbKnown);
+            if (anIsUsed[aSlot]
+             || std::find(aBucketSlots.begin(), aBucketSlots.end(), aSlot) != aBucketSlots.end())
+              break;
+            aBucketSlots.push_back(aSlot);
+          }
+          if (aBucketSlots.size() != anExts.size())
+            continue;
+
+          Displacements[aBucket] = (uint16_t)aDisp;
+          for (size_t anExtIter = 0; anExtIter < anExts.size(); ++anExtIter)
+          {
+            anIsUsed[aBucketSlots[anExtIter]] = true;
+            Slots[aBucketSlots[anExtIter]] = (uint16_t)anExts[anExtIter];
+          }
+          break;
+        }
+      }
+    }
+
+    //! Return registry index of the name or -1.
+    int Find(const char* theName, size_t theLen) const
+    {
+      const uint16_t aDisp = Displacements[hashName(theName, theLen, 0) % Displacements.size()];
+      if (aDisp == 0)
+        return -1;
+      else if (aDisp == THE_DISP_SORTED)
+        return findSorted(theName, theLen);
+
+      const int anIndex = Slots[hashName(theName, theLen, aDisp) % Slots.size()];
+      const char* aKnown = THE_KNOWN_EXTENSIONS[anIndex];
+      return strncmp(aKnown, theName, theLen) == 0 && aKnown[theLen] == '\0' ? anIndex : -1;
+    }
+
+    //! Return registry index of the name or -1 using binary search.
+    static int findSorted(const char* theName, size_t theLen)
+    {
+      int aLower = 0, anUpper = ExtensionBitset::THE_NB_KNOWN;
+      while (aLower < anUpper)
+      {
+        const int aMid = (aLower + anUpper) / 2;
+        const char* aKnown = THE_KNOWN_EXTENSIONS[aMid];
+        int aCmp = strncmp(aKnown, theName, theLen);
+        if (aCmp == 0 && aKnown[theLen] != '\0')
+          aCmp = 1; // longer name with the same prefix
+        if (aCmp == 0)
+          return aMid;
+        else if (aCmp < 0)
+          aLower = aMid + 1;
+        else
+          anUpper = aMid;
+      }
+      return -1;
+    }
+  };
+
+  //! Return index of known extensions, built on first use.
+  static const KnownExtensionsIndex& knownExtensionsIndex()
+  {
+    static const KnownExtensionsIndex THE_INDEX;
+    return THE_INDEX;
+  }
+}
+
+const char* ExtensionBitset::KnownName(int theIndex)
+{
+  return THE_KNOWN_EXTENSIONS[theIndex];
+}
+
+int ExtensionBitset::FindKnown(const char* theName, size_t theLen)
+{
+  return knownExtensionsIndex().Find(theName, theLen);
+}
+
+uint32_t ExtensionBitset::RegistryId()
+{
+  return knownExtensionsIndex().RegistryId;
+}
+
+void ExtensionBitset::Clear()
+{
+  memset(myWords, 0, sizeof(myWords));
+  myUnknown.clear();
+}
+
+void ExtensionBitset::Add(const char* theName, size_t theLen)
+{
+  if (theLen == 0)
+    return;
+
+  const int anIndex = FindKnown(theName, theLen);
+  if (anIndex != -1)
+  {
+    myWords[anIndex >> 6] |= uint64_t(1) << (anIndex & 63);
+    return;
+  }
+
+  const std::string aName(theName, theLen);
+  if (std::find(myUnknown.begin(), myUnknown.end(), aName) == myUnknown.end())
+    myUnknown.push_back(aName);
+}
+
+void ExtensionBitset::AddList(const char* theList)
+{
+  if (theList == nullptr)
+    return;
+
+  const char* aStart = theList;
+  for (const char* aCharIter = theList;; ++aCharIter)
+  {
+    if (*aCharIter == ' ' || *aCharIter == '\0')
+    {
+      Add(aStart, size_t(aCharIter - aStart));
+      if (*aCharIter == '\0')
+        break;
+      aStart = aCharIter + 1;
+    }
+  }
+}
+
+void ExtensionBitset::AddList(const std::vector<std::string>& theList)
+{
+  for (const std::string& anExt : theList)
+    Add(anExt);
+}
+
+bool ExtensionBitset::Has(const char* theName, size_t theLen) const
+{
+  const int anIndex = FindKnown(theName, theLen);
+  if (anIndex != -1)
+    return HasKnown(anIndex);
+
+  for (const std::string& anUnknown : myUnknown)
+  {
+    if (anUnknown.length() == theLen && memcmp(anUnknown.c_str(), theName, theLen) == 0)
+      return true;
+  }
+  return false;
+}
+
+int ExtensionBitset::NbKnown() const
+{
+  int aNbBits = 0;
+  for (int aWordIter = 0; aWordIter < THE_NB_WORDS; ++aWordIter)
+  {
+    for (uint64_t aWord = myWords[aWordIter]; aWord != 0; aWord &= aWord - 1)
+      ++aNbBits;
+  }
+  return aNbBits;
+}
+
+void ExtensionBitset::Intersect(const ExtensionBitset& theOther)
+{
+  for (int aWordIter = 0; aWordIter < THE_NB_WORDS; ++aWordIter)
+    myWords[aWordIter] &= theOther.myWords[aWordIter];
+
+  myUnknown.erase(std::remove_if(myUnknown.begin(), myUnknown.end(),
+                                 [&theOther](const std::string& theName)
+                                 { return std::find(theOther.myUnknown.begin(), theOther.myUnknown.end(), theName) == theOther.myUnknown.end(); }),
+                  myUnknown.end());
+}
+
+void ExtensionBitset::Unite(const ExtensionBitset& theOther)
+{
+  for (int aWordIter = 0; aWordIter < THE_NB_WORDS; ++aWordIter)
+    myWords[aWordIter] |= theOther.myWords[aWordIter];
+
+  for (const std::string& anUnknown : theOther.myUnknown)
+    Add(anUnknown);
+}
+
+bool ExtensionBitset::IsEqual(const ExtensionBitset& theOther) const
+{
+  if (memcmp(myWords, theOther.myWords, sizeof(myWords)) != 0
+   || myUnknown.size() != theOther.myUnknown.size())
+  {
+    return false;
+  }
+
+  for (const std::string& anUnknown : myUnknown)
+  {
+    if (std::find(theOther.myUnknown.begin(), theOther.myUnknown.end(), anUnknown) == theOther.myUnknown.end())
+      return false;
+  }
+  return true;
+}
+
+std::string ExtensionBitset::ToHex() const
+{
+  static const char THE_HEX[] = "0123456789abcdef";
+  std::string aHex;
+  aHex.reserve(THE_NB_WORDS * 16);
+  for (int aWordIter = 0; aWordIter < THE_NB_WORDS; ++aWordIter)
+  {
+    for (int aNibbleIter = 0; aNibbleIter < 16; ++aNibbleIter)
+      aHex += THE_HEX[(myWords[aWordIter] >> (aNibbleIter * 4)) & 0xF];
+  }
+
+  const size_t aLast = aHex.find_last_not_of('0');
+  aHex.resize(aLast != std::string::npos ? aLast + 1 : 0);
+  return aHex;
+}
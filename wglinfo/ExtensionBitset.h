@@ -0,0 +1,99 @@
+// Copyright © Kirill Gavrilov, 2026
+//
+// This code is licensed under MIT license (see LICENSE.txt for details).
+
+#ifndef EXTENSIONBITSET_HEADER
+#define EXTENSIONBITSET_HEADER
+
+#include <cstdint>
+#include <cstring>
+#include <string>
+#include <vector>
+
+//! Compact representation of an extension list as a fixed-size bitset
+//! over the registry of known GL / GLES / EGL / GLX / WGL extension names,
+//! with names missing in the registry kept in a small side list.
+//!
+//! The registry is a constant table sorted by name; bit index is the position within this table.
+//! Names are resolved via a minimal perfect hash (hash and displace) built once on first use.
+//! Bitsets are comparable only when built with the same registry, see RegistryId().
+class ExtensionBitset
+{
+public:
+
+  //! Number of names in the registry of known extensions.
+  static const int THE_NB_KNOWN = 1150;
+
+  //! Number of 64-bit words in the bitset.
+  static const int THE_NB_WORDS = (THE_NB_KNOWN + 63) / 64;
+
+  //! Return name of known extension by its bit index.
+  static const char* KnownName(int theIndex);
+
+  //! Return bit index of known extension or -1 if name is not in the registry.
+  static int FindKnown(const char* theName, size_t theLen);
+
+  //! Return bit index of known extension or -1 if name is not in the registry.
+  static int FindKnown(const std::string& theName) { return FindKnown(theName.c_str(), theName.length()); }
+
+  //! Return identifier of the registry (hash of all names), to check bitsets are comparable.
+  static uint32_t RegistryId();
+
+public:
+
+  //! Empty constructor.
+  ExtensionBitset() { Clear(); }
+
+  //! Remove all extensions.
+  void Clear();
+
+  //! Add extension name.
+  void Add(const char* theName, size_t theLen);
+
+  //! Add extension name.
+  void Add(const std::string& theName) { Add(theName.c_str(), theName.length()); }
+
+  //! Add space-separated list of extensions; NULL is ignored.
+  void AddList(const char* theList);
+
+  //! Add list of extensions.
+  void AddList(const std::vector<std::string>& theList);
+
+  //! Return TRUE if extension is within the set.
+  bool Has(const char* theName, size_t theLen) const;
+
+  //! Return TRUE if extension is within the set.
+  bool Has(const std::string& theName) const { return Has(theName.c_str(), theName.length()); }
+
+  //! Return TRUE if bit of known extension is set.
+  bool HasKnown(int theIndex) const { return (myWords[theIndex >> 6] & (uint64_t(1) << (theIndex & 63))) != 0; }
+
+  //! Return number of known extensions in the set.
+  int NbKnown() const;
+
+  //! Return names not found in the registry, in order of addition.
+  const std::vector<std::string>& Unknown() const { return myUnknown; }
+
+  //! Return bitset words.
+  const uint64_t* Words() const { return myWords; }
+
+  //! Keep only extensions presented in both sets.
+  void Intersect(const ExtensionBitset& theOther);
+
+  //! Add all extensions of another set.
+  void Unite(const ExtensionBitset& theOther);
+
+  //! Return TRUE if sets are equal (order of unknown names is ignored).
+  bool IsEqual(const ExtensionBitset& theOther) const;
+
+  //! Return known bits as hex string, where character N encodes bits [4N, 4N+3]; trailing zeros are omitted.
+  std::string ToHex() const;
+
+private:
+
+  uint64_t                 myWords[THE_NB_WORDS]; //!< bits of known extensions
+  std::vector<std::string> myUnknown;             //!< names missing in the registry
+
+};
+
+#endif // EXTENSIONBITSET_HEADER
@@ -0,0 +1,131 @@
+// Copyright © Kirill Gavrilov, 2026
+//
+// This code is licensed under MIT license (see LICENSE.txt for details).
+
+#include "ExtensionSet.h"
+
+uint32_t ExtensionSet::hashName(const char* theName, size_t theLen)
+{
+  uint32_t aHash = 2166136261u;
+  for (size_t aCharIter = 0; aCharIter < theLen; ++aCharIter)
+  {
+    aHash ^= (uint8_t)theName[aCharIter];
+    aHash *= 16777619u;
+  }
+  return aHash;
+}
+
+void ExtensionSet::Clear()
+{
+  myBuffer.clear();
+  myTokens.clear();
+  mySlots.clear();
+}
+
+void ExtensionSet::Init(const char* theList)
+{
+  Clear();
+  if (theList == nullptr)
+    return;
+
+  // reserve for the whole string to avoid re-allocations while interning
+  size_t aNbNames = 0;
+  for (const char* aCharIter = theList; *aCharIter != '\0'; ++aCharIter)
+  {
+    if (*aCharIter == ' ' && aCharIter[1] != ' ')
+      ++aNbNames;
+  }
+  myBuffer.reserve(strlen(theList) + 1);
+  myTokens.reserve(aNbNames + 1);
+  size_t aNbSlots = 16;
+  while (aNbSlots < (aNbNames + 1) * 2)
+    aNbSlots *= 2;
+  rehash(aNbSlots);
+
+  const char* aNameIter = theList;
+  for (;;)
+  {
+    while (*aNameIter == ' ' || *aNameIter == '\t' || *aNameIter == '\n')
+      ++aNameIter;
+    if (*aNameIter == '\0')
+      break;
+
+    const char* aNameEnd = aNameIter;
+    while (*aNameEnd != '\0' && *aNameEnd != ' ' && *aNameEnd != '\t' && *aNameEnd != '\n')
+      ++aNameEnd;
+
+    Add(aNameIter, size_t(aNameEnd - aNameIter));
+    aNameIter = aNameEnd;
+  }
+}
+
+int ExtensionSet::find(const char* theName, size_t theLen, uint32_t theHash) const
+{
+  if (mySlots.empty())
+    return -1;
+
+  const size_t aMask = mySlots.size() - 1;
+  for (size_t aSlot = theHash & aMask;; aSlot = (aSlot + 1) & aMask)
+  {
+    const uint32_t anIndex = mySlots[aSlot];
+    if (anIndex == 0)
+      return -1;
+
+    const Token& aToken = myTokens[anIndex - 1];
+    if (aToken.Hash == theHash
+     && aToken.Length == theLen
+     && memcmp(myBuffer.c_str() + aToken.Offset, theName, theLen) == 0)
+    {
+      return int(anIndex - 1);
+    }
+  }
+}
+
+bool ExtensionSet::Has(const char* theName, size_t theLen) const
+{
+  return find(theName, theLen, hashName(theName, theLen)) != -1;
+}
+
+void ExtensionSet::Add(const char* theName, size_t theLen)
+{
+  if (theLen == 0)
+    return;
+
+  const uint32_t aHash = hashName(theName, theLen);
+  if (find(theName, theLen, aHash) != -1)
+    return;
+
+  Token aToken;
+  aToken.Offset = (uint32_t)myBuffer.size();
+  aToken.Length = (uint32_t)theLen;
+  aToken.Hash   = aHash;
+  myBuffer.append(theName, theLen);
+  myBuffer.push_back('\0');
+  myTokens.push_back(aToken);
+
+  // keep load factor below 1/2
+  if (myTokens.size() * 2 > mySlots.size())
+  {
+    rehash(mySlots.size() * 2 > 16 ? mySlots.size() * 2 : 16);
+    return;
+  }
+
+  const size_t aMask = mySlots.size() - 1;
+  size_t aSlot = aHash & aMask;
+  while (mySlots[aSlot] != 0)
+    aSlot = (aSlot + 1) & aMask;
+  mySlots[aSlot] = (uint32_t)myTokens.size();
+}
+
+void ExtensionSet::rehash(size_t theNbSlots)
+{
+  mySlots.assign(theNbSlots, 0);
+  const size_t aMask = theNbSlots - 1;
+  for (size_t aTokenIter = 0; aTokenIter < myTokens.size(); ++aTokenIter)
+  {
+    size_t aSlot = myTokens[aTokenIter].Hash & aMask;
+    while (mySlots[aSlot] != 0)
+      aSlot = (aSlot + 1) & aMask;
+    mySlots[aSlot] = uint32_t(aTokenIter + 1);
+  }
+}
@@ -0,0 +1,85 @@
+// Copyright © Kirill Gavrilov, 2026
+//
+// This code is licensed under MIT license (see LICENSE.txt for details).
+
+#ifndef EXTENSIONSET_HEADER
+#define EXTENSIONSET_HEADER
+
+#include <cstdint>
+#include <cstring>
+#include <string>
+#include <vector>
+
+//! Set of extension names built once from a space-separated extension string.
+//! Names are interned into a single buffer and indexed by an open-addressing hash table,
+//! so that Has() performs a whole-word lookup in O(1) without memory allocations.
+class ExtensionSet
+{
+public:
+
+  //! Empty constructor.
+  ExtensionSet() {}
+
+  //! Constructor from space-separated extension string.
+  explicit ExtensionSet(const char* theList) { Init(theList); }
+
+  //! Constructor from space-separated extension string.
+  explicit ExtensionSet(const std::string& theList) { Init(theList.c_str()); }
+
+  //! Re-initialize set from space-separated extension string; NULL string defines an empty set.
+  void Init(const char* theList);
+
+  //! Remove all names.
+  void Clear();
+
+  //! Add extension name; duplicates are ignored.
+  void Add(const char* theName, size_t theLen);
+
+  //! Return TRUE if set is empty.
+  bool IsEmpty() const { return myTokens.empty(); }
+
+  //! Return number of unique names.
+  size_t Size() const { return myTokens.size(); }
+
+  //! Return name by index in order of appearance.
+  const char* Name(size_t theIndex) const { return myBuffer.c_str() + myTokens[theIndex].Offset; }
+
+  //! Return TRUE if extension is within the set.
+  bool Has(const char* theName, size_t theLen) const;
+
+  //! Return TRUE if extension is within the set.
+  bool Has(const char* theName) const { return theName != nullptr && Has(theName, strlen(theName)); }
+
+  //! Return TRUE if extension is within the set.
+  bool Has(const std::string& theName) const { return Has(theName.c_str(), theName.length()); }
+
+private:
+
+  //! Return FNV-1a hash of the name.
+  static uint32_t hashName(const char* theName, size_t theLen);
+
+  //! Return index of token with specified name or -1.
+  int find(const char* theName, size_t theLen, uint32_t theHash) const;
+
+  //! Rebuild hash table for specified number of slots.
+  void rehash(size_t theNbSlots);
+
+private:
+
+  //! Interned name.
+  struct Token
+  {
+    uint32_t Offset = 0; //!< offset within buffer
+    uint32_t Length = 0; //!< name length
+    uint32_t Hash   = 0; //!< name hash
+  };
+
+private:
+
+  std::string           myBuffer; //!< interned names separated by '\0'
+  std::vector<Token>    myTokens; //!< names in order of appearance
+  std::vector<uint32_t> mySlots;  //!< hash table of token indices (+1), 0 for empty slot
+
+};
+
+#endif // EXTENSIONSET_HEADER
@@ -0,0 +1,135 @@
+// Copyright © Kirill Gavrilov, 2026
+//
+// This code is licensed under MIT license (see LICENSE.txt for details).
+
+#include "GlBenchmark.h"
+
+#include "BufferStreamBenchmark.h"
+#include "ClearBenchmark.h"
+#include "ReadbackBenchmark.h"
+#include "TextureUploadBenchmark.h"
+
+#include <cctype>
+#include <cstdlib>
+
+#define GL_VERSION 0x1F02
+
+std::vector<GlBenchmark::Info>& GlBenchmark::Registry()
+{
+  static std::vector<Info> THE_REGISTRY =
+  {
+    { "fbo-clear", "glClear() of RGBA8 framebuffer object of several sizes",
+      []() -> GlBenchmark* { return new ClearBenchmark(); } },
+    { "tex-upload", "glTexSubImage2D() throughput of color/depth formats from client memory and PBO",
+      []() -> GlBenchmark* { return new TextureUploadBenchmark(); } },
+    { "readback", "glReadPixels() vs PBO ring with fences vs glGetTextureSubImage() of rendered frames",
+      []() -> GlBenchmark* { return new ReadbackBenchmark(); } },
+    { "buf-stream", "per-frame buffer streaming by glBufferSubData(), orphaning, unsynchronized and persistent mapping",
+      []() -> GlBenchmark* { return new BufferStreamBenchmark(); } },
+  };
+  return THE_REGISTRY;
+}
+
+void GlBenchmark::Register(const Info& theInfo)
+{
+  std::vector<Info>& aRegistry = Registry();
+  for (Info& anInfo : aRegistry)
+  {
+    if (anInfo.Name == theInfo.Name)
+    {
+      anInfo = theInfo;
+      return;
+    }
+  }
+  aRegistry.push_back(theInfo);
+}
+
+//! Match name against a single glob pattern.
+static bool matchGlob(const char* thePattern, const char* theName)
+{
+  for (; *thePattern != '\0'; ++thePattern, ++theName)
+  {
+    if (*thePattern == '*')
+    {
+      // try to match the rest of pattern at each position
+      for (const char* aNameIter = theName;; ++aNameIter)
+      {
+        if (matchGlob(thePattern + 1, aNameIter))
+          return true;
+        if (*aNameIter == '\0')
+          return false;
+      }
+    }
+    else if (*theName == '\0'
+          || (*thePattern != '?' && *thePattern != *theName))
+    {
+      return false;
+    }
+  }
+  return *theName == '\0';
+}
+
+bool GlBenchmark::MatchPattern(const std::string& thePattern, const std::string& theName)
+{
+  size_t aStart = 0;
+  for (;;)
+  {
+    const size_t anEnd = thePattern.find(',', aStart);
+    const std::string aPattern = thePattern.substr(aStart, anEnd == std::string::npos ? std::string::npos : anEnd - aStart);
+    if (!aPattern.empty()
+     && matchGlob(aPattern.c_str(), theName.c_str()))
+    {
+      return true;
+    }
+    if (anEnd == std::string::npos)
+      return false;
+    aStart = anEnd + 1;
+  }
+}
+
+std::vector<GlBenchmark::Info> GlBenchmark::Find(const std::string& thePattern)
+{
+  std::vector<Info> aResult;
+  for (const Info& anInfo : Registry())
+  {
+    if (MatchPattern(thePattern, anInfo.Name))
+      aResult.push_back(anInfo);
+  }
+  return aResult;
+}
+
+bool GlBenchmark::ContextVersion(BaseGlContext& theCtx, int& theMajor, int& theMinor)
+{
+  theMajor = theMinor = 0;
+  const char* aVersion = theCtx.GlGetString(GL_VERSION);
+  if (aVersion == nullptr)
+    return false;
+
+  // skip prefix like "OpenGL ES "
+  for (; *aVersion != '\0' && !isdigit((unsigned char )*aVersion); ++aVersion) {}
+  char* anEnd = nullptr;
+  theMajor = (int )strtol(aVersion, &anEnd, 10);
+  if (anEnd == aVersion || *anEnd != '.')
+    return false;
+
+  theMinor = (int )strtol(anEnd + 1, nullptr, 10);
+  return true;
+}
+
+void GlBenchmark::ContextExtensions(BaseGlContext& theCtx, ExtensionSet& theExtensions)
+{
+  RendererReport aReport;
+  theCtx.CollectExtensions(aReport);
+  theExtensions.Clear();
+  for (const std::string& anExt : aReport.Extensions)
+    theExtensions.Add(anExt.c_str(), anExt.length());
+}
+
+bool GlBenchmark::Init(BaseGlContext& theCtx, std::string& theReason)
+{
+  myCtx = &theCtx;
+  myCases.clear();
+  ContextVersion(theCtx, myVerMajor, myVerMinor);
+  ContextExtensions(theCtx, myExtensions);
+  return init(theReason);
+}
@@ -0,0 +1,144 @@
+// Copyright © Kirill Gavrilov, 2026
+//
+// This code is licensed under MIT license (see LICENSE.txt for details).
+
+#ifndef GLBENCHMARK_HEADER
+#define GLBENCHMARK_HEADER
+
+#include "BaseGlContext.h"
+#include "ExtensionSet.h"
+
+#include <functional>
+#include <string>
+#include <vector>
+
+//! Base interface of a micro-benchmark executed by BenchmarkRunner on a created context.
+//! Benchmark defines a list of cases (like format and size combinations);
+//! the runner executes warmup and measured iterations of each case and collects statistics.
+//! Iterate() should only submit commands - the runner measures submission (CPU) time
+//! and waits for completion to measure GPU time.
+class GlBenchmark
+{
+public:
+
+  //! Registered benchmark.
+  struct Info
+  {
+    std::string Name;        //!< benchmark name used for selection, like "fbo-clear"
+    std::string Description; //!< short description
+    std::function<GlBenchmark*()> Create; //!< benchmark factory
+  };
+
+  //! Return registry of benchmarks, including built-in ones.
+  static std::vector<Info>& Registry();
+
+  //! Register benchmark (replacing registered one with the same name).
+  static void Register(const Info& theInfo);
+
+  //! Return TRUE if name matches comma-separated list of glob patterns (with '*' and '?' wildcards).
+  static bool MatchPattern(const std::string& thePattern, const std::string& theName);
+
+  //! Return registered benchmarks matching comma-separated list of glob patterns.
+  static std::vector<Info> Find(const std::string& thePattern);
+
+  //! Parse version of the context made current from GL_VERSION string
+  //! (like "4.6 (Core Profile) Mesa" or "OpenGL ES 3.2 Mesa").
+  //! @return FALSE if version cannot be parsed
+  static bool ContextVersion(BaseGlContext& theCtx, int& theMajor, int& theMinor);
+
+  //! Collect extensions of the context made current.
+  static void ContextExtensions(BaseGlContext& theCtx, ExtensionSet& theExtensions);
+
+public:
+
+  //! Measured case.
+  struct Case
+  {
+    std::string Name;         //!< case name, like "RGBA8 1024x1024"
+    double      NbBytes = 0.0; //!< bytes transferred per iteration for throughput; 0 if not applicable
+  };
+
+public:
+
+  //! Destructor.
+  virtual ~GlBenchmark() {}
+
+  //! Initialize benchmark for the context made current and define the list of cases.
+  //! @param theReason [out] reason why benchmark is not supported by context
+  //! @return FALSE if benchmark is not supported by context
+  bool Init(BaseGlContext& theCtx, std::string& theReason);
+
+  //! Return list of cases.
+  const std::vector<Case>& Cases() const { return myCases; }
+
+  //! Set framebuffer resolutions of benchmarks rendering into framebuffer;
+  //! should be called before Init(). Empty list means default resolutions of the benchmark.
+  void SetResolutions(const std::vector<std::pair<int, int>>& theResolutions) { myResolutions = theResolutions; }
+
+  //! Return TRUE if iterations of the case are pipelined (results are consumed few iterations later),
+  //! so that runner should not wait for completion of each iteration.
+  virtual bool IsPipelined(size_t theCase) const { (void )theCase; return false; }
+
+  //! Return latency in milliseconds of the frame which result has been consumed by the last iteration;
+  //! negative if benchmark doesn't measure latency or no result has been consumed yet.
+  double LastLatencyMs() const { return myLastLatencyMs; }
+
+  //! Return error of the last iteration (like a failed fence wait), which makes measurements of the case invalid;
+  //! empty string if iteration has succeeded. Benchmark should clear it within SetupCase().
+  const std::string& IterationError() const { return myIterError; }
+
+  //! Prepare resources of the case before warmup iterations.
+  //! @return FALSE if case cannot be executed
+  virtual bool SetupCase(size_t theCase) { (void )theCase; return true; }
+
+  //! Submit commands of a single iteration of the case.
+  virtual void Iterate(size_t theCase) = 0;
+
+  //! Release resources of the case.
+  virtual void ReleaseCase(size_t theCase) { (void )theCase; }
+
+  //! Release resources allocated by Init().
+  virtual void Release() {}
+
+protected:
+
+  //! Empty constructor.
+  GlBenchmark() {}
+
+  //! Initialize benchmark and fill myCases.
+  virtual bool init(std::string& theReason) = 0;
+
+  //! Return GL functions of the context.
+  const GlFunctions& gl() const { return myCtx->Gl(); }
+
+  //! Return TRUE if context is OpenGL ES.
+  bool isGles() const { return (myCtx->Bits() & BaseGlContext::ContextBits_GLES) != 0; }
+
+  //! Return TRUE if context version is equal or higher than specified one.
+  bool isGlGreaterEqual(int theMajor, int theMinor) const
+  {
+    return myVerMajor > theMajor || (myVerMajor == theMajor && myVerMinor >= theMinor);
+  }
+
+  //! Return TRUE if extension is supported by context.
+  bool hasExtension(const char* theName) const { return myExtensions.Has(theName); }
+
+private:
+
+  GlBenchmark(const GlBenchmark& ) = delete;
+  GlBenchmark& operator=(const GlBenchmark& ) = delete;
+
+protected:
+
+  BaseGlContext*    myCtx = nullptr; //!< context
+  std::vector<Case> myCases;         //!< list of cases
+  ExtensionSet      myExtensions;    //!< extensions of the context
+  int               myVerMajor = 0;  //!< context version
+  int               myVerMinor = 0;
+  std::vector<std::pair<int, int>> myResolutions; //!< framebuffer resolutions requested by user
+  double            myLastLatencyMs = -1.0; //!< latency of the frame consumed by the last iteration
+  std::string       myIterError;     //!< error of the last iteration, stopping the case
+
+};
+
+#endif // GLBENCHMARK_HEADER
@@ -0,0 +1,63 @@
+// Copyright © Kirill Gavrilov, 2026
+//
+// This code is licensed under MIT license (see LICENSE.txt for details).
+
+#include "GlFunctions.h"
+
+//! Resolve function, if not yet defined.
+template<typename FuncType_t>
+static void loadProc(const std::function<void* (const char* )>& theGetProc, FuncType_t& theFunc, const char* theName)
+{
+  if (theFunc == nullptr)
+    theFunc = (FuncType_t )theGetProc(theName);
+}
+
+void GlFunctions::Load(const std::function<void* (const char* )>& theGetProc)
+{
+  loadProc(theGetProc, glGetError, "glGetError");
+  loadProc(theGetProc, glGetString, "glGetString");
+  loadProc(theGetProc, glGetStringi, "glGetStringi");
+  loadProc(theGetProc, glGetIntegerv, "glGetIntegerv");
+  loadProc(theGetProc, glGetInteger64v, "glGetInteger64v");
+  loadProc(theGetProc, glFlush, "glFlush");
+  loadProc(theGetProc, glFinish, "glFinish");
+  loadProc(theGetProc, glFenceSync, "glFenceSync");
+  loadProc(theGetProc, glClientWaitSync, "glClientWaitSync");
+  loadProc(theGetProc, glDeleteSync, "glDeleteSync");
+  loadProc(theGetProc, glGenQueries, "glGenQueries");
+  loadProc(theGetProc, glDeleteQueries, "glDeleteQueries");
+  loadProc(theGetProc, glBeginQuery, "glBeginQuery");
+  loadProc(theGetProc, glEndQuery, "glEndQuery");
+  loadProc(theGetProc, glQueryCounter, "glQueryCounter");
+  loadProc(theGetProc, glGetQueryObjectiv, "glGetQueryObjectiv");
+  loadProc(theGetProc, glGetQueryObjectui64v, "glGetQueryObjectui64v");
+  loadProc(theGetProc, glViewport, "glViewport");
+  loadProc(theGetProc, glClearColor, "glClearColor");
+  loadProc(theGetProc, glClear, "glClear");
+  loadProc(theGetProc, glReadPixels, "glReadPixels");
+  loadProc(theGetProc, glGenFramebuffers, "glGenFramebuffers");
+  loadProc(theGetProc, glDeleteFramebuffers, "glDeleteFramebuffers");
+  loadProc(theGetProc, glBindFramebuffer, "glBindFramebuffer");
+  loadProc(theGetProc, glFramebufferTexture2D, "glFramebufferTexture2D");
+  loadProc(theGetProc, glCheckFramebufferStatus, "glCheckFramebufferStatus");
+  loadProc(theGetProc, glGenTextures, "glGenTextures");
+  loadProc(theGetProc, glDeleteTextures, "glDeleteTextures");
+  loadProc(theGetProc, glBindTexture, "glBindTexture");
+  loadProc(theGetProc, glTexParameteri, "glTexParameteri");
+  loadProc(theGetProc, glPixelStorei, "glPixelStorei");
+  loadProc(theGetProc, glTexImage2D, "glTexImage2D");
+  loadProc(theGetProc, glTexSubImage2D, "glTexSubImage2D");
+  loadProc(theGetProc, glTexStorage2D, "glTexStorage2D");
+  loadProc(theGetProc, glGetTexImage, "glGetTexImage");
+  loadProc(theGetProc, glGetTextureSubImage, "glGetTextureSubImage");
+  loadProc(theGetProc, glGenBuffers, "glGenBuffers");
+  loadProc(theGetProc, glDeleteBuffers, "glDeleteBuffers");
+  loadProc(theGetProc, glBindBuffer, "glBindBuffer");
+  loadProc(theGetProc, glBufferData, "glBufferData");
+  loadProc(theGetProc, glBufferSubData, "glBufferSubData");
+  loadProc(theGetProc, glBufferStorage, "glBufferStorage");
+  loadProc(theGetProc, glMapBufferRange, "glMapBufferRange");
+  loadProc(theGetProc, glUnmapBuffer, "glUnmapBuffer");
+  loadProc(theGetProc, glFlushMappedBufferRange, "glFlushMappedBufferRange");
+  loadProc(theGetProc, glCopyBufferSubData, "glCopyBufferSubData");
+}
@@ -0,0 +1,96 @@
+// Copyright © Kirill Gavrilov, 2026
+//
+// This code is licensed under MIT license (see LICENSE.txt for details).
+
+#ifndef GLFUNCTIONS_HEADER
+#define GLFUNCTIONS_HEADER
+
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+
+#ifdef _WIN32
+  #define GLFUNCTIONS_APIENTRY __stdcall
+#else
+  #define GLFUNCTIONS_APIENTRY
+#endif
+
+//! Table of GL functions used by the tool, resolved once per context after it has been made current.
+//! Functions unavailable in the context are left NULL.
+struct GlFunctions
+{
+  // queries
+  unsigned int         (GLFUNCTIONS_APIENTRY *glGetError)(void) = nullptr;
+  const unsigned char* (GLFUNCTIONS_APIENTRY *glGetString)(unsigned int theName) = nullptr;
+  const unsigned char* (GLFUNCTIONS_APIENTRY *glGetStringi)(unsigned int theName, unsigned int theIndex) = nullptr;
+  void (GLFUNCTIONS_APIENTRY *glGetIntegerv)  (unsigned int theName, int* theParams) = nullptr;
+  void (GLFUNCTIONS_APIENTRY *glGetInteger64v)(unsigned int theName, int64_t* theParams) = nullptr;
+
+  // synchronization
+  void  (GLFUNCTIONS_APIENTRY *glFlush) (void) = nullptr;
+  void  (GLFUNCTIONS_APIENTRY *glFinish)(void) = nullptr;
+  void* (GLFUNCTIONS_APIENTRY *glFenceSync)(unsigned int theCondition, unsigned int theFlags) = nullptr;
+  unsigned int (GLFUNCTIONS_APIENTRY *glClientWaitSync)(void* theSync, unsigned int theFlags, uint64_t theTimeout) = nullptr;
+  void  (GLFUNCTIONS_APIENTRY *glDeleteSync)(void* theSync) = nullptr;
+
+  // timer queries
+  void (GLFUNCTIONS_APIENTRY *glGenQueries)   (int theNb, unsigned int* theIds) = nullptr;
+  void (GLFUNCTIONS_APIENTRY *glDeleteQueries)(int theNb, const unsigned int* theIds) = nullptr;
+  void (GLFUNCTIONS_APIENTRY *glBeginQuery)   (unsigned int theTarget, unsigned int theId) = nullptr;
+  void (GLFUNCTIONS_APIENTRY *glEndQuery)     (unsigned int theTarget) = nullptr;
+  void (GLFUNCTIONS_APIENTRY *glQueryCounter) (unsigned int theId, unsigned int theTarget) = nullptr;
+  void (GLFUNCTIONS_APIENTRY *glGetQueryObjectiv)   (unsigned int theId, unsigned int theName, int* theParams) = nullptr;
+  void (GLFUNCTIONS_APIENTRY *glGetQueryObjectui64v)(unsigned int theId, unsigned int theName, uint64_t* theParams) = nullptr;
+
+  // framebuffer
+  void (GLFUNCTIONS_APIENTRY *glViewport)  (int theX, int theY, int theWidth, int theHeight) = nullptr;
+  void (GLFUNCTIONS_APIENTRY *glClearColor)(float theR, float theG, float theB, float theA) = nullptr;
+  void (GLFUNCTIONS_APIENTRY *glClear)     (unsigned int theMask) = nullptr;
+  void (GLFUNCTIONS_APIENTRY *glReadPixels)(int theX, int theY, int theWidth, int theHeight,
+                                            unsigned int theFormat, unsigned int theType, void* thePixels) = nullptr;
+  void (GLFUNCTIONS_APIENTRY *glGenFramebuffers)   (int theNb, unsigned int* theIds) = nullptr;
+  void (GLFUNCTIONS_APIENTRY *glDeleteFramebuffers)(int theNb, const unsigned int* theIds) = nullptr;
+  void (GLFUNCTIONS_APIENTRY *glBindFramebuffer)   (unsigned int theTarget, unsigned int theId) = nullptr;
+  void (GLFUNCTIONS_APIENTRY *glFramebufferTexture2D)(unsigned int theTarget, unsigned int theAttachment,
+                                                      unsigned int theTexTarget, unsigned int theTexture, int theLevel) = nullptr;
+  unsigned int (GLFUNCTIONS_APIENTRY *glCheckFramebufferStatus)(unsigned int theTarget) = nullptr;
+
+  // textures
+  void (GLFUNCTIONS_APIENTRY *glGenTextures)   (int theNb, unsigned int* theIds) = nullptr;
+  void (GLFUNCTIONS_APIENTRY *glDeleteTextures)(int theNb, const unsigned int* theIds) = nullptr;
+  void (GLFUNCTIONS_APIENTRY *glBindTexture)   (unsigned int theTarget, unsigned int theId) = nullptr;
+  void (GLFUNCTIONS_APIENTRY *glTexParameteri) (unsigned int theTarget, unsigned int theName, int theParam) = nullptr;
+  void (GLFUNCTIONS_APIENTRY *glPixelStorei)   (unsigned int theName, int theParam) = nullptr;
+  void (GLFUNCTIONS_APIENTRY *glTexImage2D)(unsigned int theTarget, int theLevel, int theInternalFormat,
+                                            int theWidth, int theHeight, int theBorder,
+                                            unsigned int theFormat, unsigned int theType, const void* thePixels) = nullptr;
+  void (GLFUNCTIONS_APIENTRY *glTexSubImage2D)(unsigned int theTarget, int theLevel, int theX, int theY,
+                                               int theWidth, int theHeight,
+                                               unsigned int theFormat, unsigned int theType, const void* thePixels) = nullptr;
+  void (GLFUNCTIONS_APIENTRY *glTexStorage2D)(unsigned int theTarget, int theLevels, unsigned int theInternalFormat,
+                                              int theWidth, int theHeight) = nullptr;
+  void (GLFUNCTIONS_APIENTRY *glGetTexImage)(unsigned int theTarget, int theLevel,
+                                             unsigned int theFormat, unsigned int theType, void* thePixels) = nullptr;
+  void (GLFUNCTIONS_APIENTRY *glGetTextureSubImage)(unsigned int theTexture, int theLevel, int theX, int theY, int theZ,
+                                                    int theWidth, int theHeight, int theDepth,
+                                                    unsigned int theFormat, unsigned int theType,
+                                                    int theBufSize, void* thePixels) = nullptr;
+
+  // buffers
+  void  (GLFUNCTIONS_APIENTRY *glGenBuffers)   (int theNb, unsigned int* theIds) = nullptr;
+  void  (GLFUNCTIONS_APIENTRY *glDeleteBuffers)(int theNb, const unsigned int* theIds) = nullptr;
+  void  (GLFUNCTIONS_APIENTRY *glBindBuffer)   (unsigned int theTarget, unsigned int theId) = nullptr;
+  void  (GLFUNCTIONS_APIENTRY *glBufferData)   (unsigned int theTarget, ptrdiff_t theSize, const void* theData, unsigned int theUsage) = nullptr;
+  void  (GLFUNCTIONS_APIENTRY *glBufferSubData)(unsigned int theTarget, ptrdiff_t theOffset, ptrdiff_t theSize, const void* theData) = nullptr;
+  void  (GLFUNCTIONS_APIENTRY *glBufferStorage)(unsigned int theTarget, ptrdiff_t theSize, const void* theData, unsigned int theFlags) = nullptr;
+  void* (GLFUNCTIONS_APIENTRY *glMapBufferRange)(unsigned int theTarget, ptrdiff_t theOffset, ptrdiff_t theLength, unsigned int theAccess) = nullptr;
+  unsigned char (GLFUNCTIONS_APIENTRY *glUnmapBuffer)(unsigned int theTarget) = nullptr;
+  void  (GLFUNCTIONS_APIENTRY *glFlushMappedBufferRange)(unsigned int theTarget, ptrdiff_t theOffset, ptrdiff_t theLength) = nullptr;
+  void  (GLFUNCTIONS_APIENTRY *glCopyBufferSubData)(unsigned int theReadTarget, unsigned int theWriteTarget,
+                                                   ptrdiff_t theReadOffset, ptrdiff_t theWriteOffset, ptrdiff_t theSize) = nullptr;
+
+  //! Resolve all functions not yet defined using specified lookup function.
+  void Load(const std::function<void* (const char* )>& theGetProc);
+};
+
+#endif // GLFUNCTIONS_HEADER
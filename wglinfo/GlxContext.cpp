@@ -4,6 +4,8 @@
 
 #include "GlxContext.h"
 
+#include "ProbeTimings.h"
+
 #if !defined(_WIN32) && !defined(__APPLE__) && !defined(__EMSCRIPTEN__)
 
 #include <GL/gl.h>
@@ -11,7 +13,9 @@
 
 #include <iomanip>
 #include <iostream>
+#include <map>
 #include <memory>
+#include <mutex>
 
 #if defined(__GNUC__) && !defined(__INTEL_COMPILER) && !defined(__clang__)
   #if (__GNUC__ > 8) || ((__GNUC__ == 8) && (__GNUC_MINOR__ >= 1))
@@ -19,8 +23,6 @@
   #endif
 #endif
 
-typedef const GLubyte* (GLAPIENTRY *glGetStringi_t) (GLenum name, GLuint index);
-
 GlxContext::GlxContext(const std::string& theTitle)
 : myWin(theTitle)
 {
@@ -40,13 +42,63 @@ void GlxContext::release()
     myRendCtx = NULL;
   }
   myWin.Destroy();
+  myGlxExts.Clear();
+  myHasGlxExts = false;
+}
+
+const ExtensionSet& GlxContext::glxExtensions()
+{
+  Display* aDisp = (Display*)myWin.GetDisplay();
+  if (!myHasGlxExts && aDisp != nullptr)
+  {
+    myHasGlxExts = true;
+    myGlxExts.Init(glXQueryExtensionsString(aDisp, DefaultScreen(aDisp)));
+  }
+  return myGlxExts;
+}
+
+GlxContext::DisplayCache GlxContext::displayCache(bool theIsSoft, const std::function<void(DisplayCache& )>& theUpdate)
+{
+  static std::mutex THE_MUTEX;
+  static std::map<std::string, DisplayCache> THE_CACHE;
+
+  Display* aDisp = (Display*)myWin.GetDisplay();
+  const std::string aKey = std::string(DisplayString(aDisp)) + "." + std::to_string(DefaultScreen(aDisp))
+                         + (theIsSoft ? ":soft" : "");
+  std::lock_guard<std::mutex> aLock(THE_MUTEX);
+  DisplayCache& aCache = THE_CACHE[aKey];
+  if (theUpdate)
+    theUpdate(aCache);
+  return aCache;
+}
+
+void GlxContext::rememberRenderer()
+{
+  if (!displayCache(false).Renderer.empty())
+    return;
+
+  const char* aVendor = GlGetString(GL_VENDOR);
+  const char* aRender = GlGetString(GL_RENDERER);
+  const std::string aVendorStr = aVendor != nullptr ? aVendor : "";
+  const std::string aRenderStr = aRender != nullptr ? aRender : "";
+  displayCache(false, [&aVendorStr, &aRenderStr](DisplayCache& theCache)
+  {
+    if (theCache.Renderer.empty())
+    {
+      theCache.Vendor   = aVendorStr;
+      theCache.Renderer = aRenderStr;
+    }
+  });
 }
 
 bool GlxContext::CreateGlContext(ContextBits theBits)
 {
   Release();
-  if (!myWin.Create())
-    return false;
+  {
+    ProbeTimings::Sentry aTimer("BaseWindow::Create");
+    if (!myWin.Create())
+      return false;
+  }
 
   myCtxBits = theBits;
 
@@ -73,11 +125,22 @@ bool GlxContext::CreateGlContext(ContextBits theBits)
   SoftMesaSentry aMesaEnvSentry;
   if (isSoftCtx)
   {
-    GlxContext aCtxCompat("wglinfoTmp");
-    if (!aCtxCompat.CreateGlContext(ContextBits_NONE)
-     || !aMesaEnvSentry.Init(aCtxCompat))
+    ProbeTimings::Sentry aTimer("SoftMesaSentry::Init");
+    const DisplayCache aCache = displayCache(false);
+    if (!aCache.Renderer.empty())
     {
-      return false;
+      // reuse renderer of another profile created on the same display
+      if (!aMesaEnvSentry.Init(SoftMesaSentry::IsSoftRenderer(aCache.Vendor, aCache.Renderer)))
+        return false;
+    }
+    else
+    {
+      GlxContext aCtxCompat("wglinfoTmp");
+      if (!aCtxCompat.CreateGlContext(ContextBits_NONE)
+       || !aMesaEnvSentry.Init(aCtxCompat))
+      {
+        return false;
+      }
     }
   }
 
@@ -102,15 +165,32 @@ bool GlxContext::CreateGlContext(ContextBits theBits)
 
   if (theBits == 0)
   {
-    myRendCtx = glXCreateContext(aDisp, aVis.get(), NULL, GL_TRUE);
+    {
+      ProbeTimings::Sentry aTimer("glXCreateContext");
+      myRendCtx = glXCreateContext(aDisp, aVis.get(), NULL, GL_TRUE);
+    }
+    ProbeTimings::Sentry aTimer("MakeCurrent");
     if (!MakeCurrent())
       return false;
 
+    loadGlFunctions();
+    rememberRenderer();
+
+    // compatible profile of 3.2+ also implies availability of the same core profile version
+    VersionHint aCompat;
+    if (updateVersionHint(aCompat))
+    {
+      displayCache(false, [&aCompat](DisplayCache& theCache)
+      {
+        theCache.Compat = aCompat;
+        if (!theCache.Core.IsValid())
+          theCache.Core = aCompat;
+      });
+    }
     return true;
   }
 
-  const char* aGlxExts = glXQueryExtensionsString(aDisp, aVisInfo.screen);
-  if (!hasExtension(aGlxExts, "GLX_ARB_create_context_profile"))
+  if (!glxExtensions().Has("GLX_ARB_create_context_profile"))
     return false;
 
   // FBConfigs were added in GLX version 1.3
@@ -134,9 +214,11 @@ bool GlxContext::CreateGlContext(ContextBits theBits)
   };
 
   int aFBCount = 0;
+  ProbeTimings::Sentry aChooseTimer("glXChooseFBConfig");
   GLXFBConfig* aFBCfgList = glXChooseFBConfig(aDisp, aScreen, TheDoubleBuffFBConfig, &aFBCount);
   GLXFBConfig  anFBConfig = (aFBCfgList != NULL && aFBCount >= 1) ? aFBCfgList[0] : 0;
   XFree(aFBCfgList);
+  aChooseTimer.Stop();
 
   // Replace default XError handler to ignore errors.
   // Warning - this is global for all threads!
@@ -164,25 +246,74 @@ bool GlxContext::CreateGlContext(ContextBits theBits)
     0, 0
   };
 
+  // try the version already known to be supported by the display first
+  DisplayCache aHints = displayCache(isSoftCtx);
+  const bool isCoreHint = isCoreCtx || isFwdCtx;
+  VersionHint aHint = isCoreHint ? aHints.Core : aHints.Compat;
+#ifdef GLX_RENDERER_OPENGL_CORE_PROFILE_VERSION_MESA
+  if (!aHint.IsValid() && !aHints.IsQueried && !isSoftCtx)
+  {
+    // maximum versions reported by Mesa without creating a context
+    typedef Bool(*glXQueryRendererIntegerMESA_t)(Display *dpy, int screen, int renderer,
+                                                 int attribute, unsigned int *value);
+    aHints.IsQueried = true;
+    glXQueryRendererIntegerMESA_t aQueryRendererMesaI = nullptr;
+    if (glxExtensions().Has("GLX_MESA_query_renderer")
+     && FindProc("glXQueryRendererIntegerMESA", aQueryRendererMesaI))
+    {
+      unsigned int aVer[2] = { 0, 0 };
+      if (aQueryRendererMesaI(aDisp, aScreen, 0, GLX_RENDERER_OPENGL_CORE_PROFILE_VERSION_MESA, aVer))
+      {
+        aHints.Core.Major = (int )aVer[0];
+        aHints.Core.Minor = (int )aVer[1];
+      }
+      if (aQueryRendererMesaI(aDisp, aScreen, 0, GLX_RENDERER_OPENGL_COMPATIBILITY_PROFILE_VERSION_MESA, aVer))
+      {
+        aHints.Compat.Major = (int )aVer[0];
+        aHints.Compat.Minor = (int )aVer[1];
+      }
+    }
+    displayCache(isSoftCtx, [&aHints](DisplayCache& theCache)
+    {
+      theCache.IsQueried = true;
+      theCache.Core   = aHints.Core;
+      theCache.Compat = aHints.Compat;
+    });
+    aHint = isCoreHint ? aHints.Core : aHints.Compat;
+  }
+#endif
+  if (aHint.IsValid())
+  {
+    aCtxAttribs[1] = aHint.Major;
+    aCtxAttribs[3] = aHint.Minor;
+    ProbeTimings::Sentry aTimer("glXCreateContextAttribsARB", aCtxAttribs[1], aCtxAttribs[3]);
+    myRendCtx = aCreateCtxProc(aDisp, anFBConfig, NULL, True, aCtxAttribs);
+  }
+
   // try to create the core profile of highest OpenGL version
   for (int aLowVer4 = 5; aLowVer4 >= 0 && myRendCtx == NULL; --aLowVer4)
   {
     aCtxAttribs[1] = 4;
     aCtxAttribs[3] = aLowVer4;
+    ProbeTimings::Sentry aTimer("glXCreateContextAttribsARB", aCtxAttribs[1], aCtxAttribs[3]);
     myRendCtx = aCreateCtxProc(aDisp, anFBConfig, NULL, True, aCtxAttribs);
   }
   for (int aLowVer3 = 3; aLowVer3 >= 2 && myRendCtx == NULL; --aLowVer3)
   {
     aCtxAttribs[1] = 3;
     aCtxAttribs[3] = aLowVer3;
+    ProbeTimings::Sentry aTimer("glXCreateContextAttribsARB", aCtxAttribs[1], aCtxAttribs[3]);
     myRendCtx = aCreateCtxProc(aDisp, anFBConfig, NULL, True, aCtxAttribs);
   }
 
+  ProbeTimings::Sentry aMakeCurrentTimer("MakeCurrent");
   if (!MakeCurrent())
   {
     Release();
     return false;
   }
+  aMakeCurrentTimer.Stop();
+  loadGlFunctions();
 
   if (isSoftCtx && !aMesaEnvSentry.IsSoftContext(*this))
   {
@@ -190,6 +321,16 @@ bool GlxContext::CreateGlContext(ContextBits theBits)
     return false;
   }
 
+  // remember version for creating next contexts on this display
+  if (updateVersionHint(aHint))
+  {
+    displayCache(isSoftCtx, [&aHint, isCoreHint](DisplayCache& theCache)
+    {
+      (isCoreHint ? theCache.Core : theCache.Compat) = aHint;
+    });
+  }
+  if (!isSoftCtx)
+    rememberRenderer();
   return true;
 }
 
@@ -212,86 +353,45 @@ void* GlxContext::GlGetProcAddress(const char* theFuncName)
   return (void*)glXGetProcAddress((const GLubyte*)theFuncName);
 }
 
-unsigned int GlxContext::GlGetError()
-{
-  return ::glGetError();
-}
-
-const char* GlxContext::GlGetString(unsigned int theGlEnum)
-{
-  const char* aStr = (const char*)::glGetString(theGlEnum);
-  if (aStr == NULL)
-  {
-    //
-  }
-  return aStr;
-}
-
-const char* GlxContext::GlGetStringi(unsigned int theGlEnum, unsigned int theIndex)
-{
-  glGetStringi_t aGetStringi = NULL;
-  if (!FindProc("glGetStringi", aGetStringi))
-    return NULL;
-
-  return (const char*)aGetStringi(theGlEnum, theIndex);
-}
-
-void GlxContext::GlGetIntegerv(unsigned int theGlEnum, int* theParams)
-{
-  ::glGetIntegerv(theGlEnum, theParams);
-}
-
-void GlxContext::PrintPlatformInfo(bool theToPrintExtensions)
+void GlxContext::CollectPlatformInfo(RendererReport& theReport, bool theToCollectExtensions)
 {
   Display*  aDisp   = (Display*)myWin.GetDisplay();
   const int aScreen = DefaultScreen(aDisp);
   if (aDisp == nullptr)
     return;
 
-  std::cout << "[" << PlatformName() << "] GLXDirectRendering: " << (glXIsDirect(aDisp, (GLXContext )myRendCtx) ? "Yes" : "No") << "\n";
-  std::cout << "[" << PlatformName() << "] GLXVendor:          " << glXQueryServerString(aDisp, aScreen, GLX_VENDOR) << "\n";
-  std::cout << "[" << PlatformName() << "] GLXVersion:         " << glXQueryServerString(aDisp, aScreen, GLX_VERSION) << "\n";
-  if (theToPrintExtensions)
-  {
-    const char* aGlxExts = glXQueryExtensionsString(aDisp, aScreen);
-    std::cout << "[" << PlatformName() << "] GLX extensions:\n";
-    printExtensions(aGlxExts);
-  }
-
-  std::cout << "[" << PlatformName() << "] GLXClientVendor:    " << glXGetClientString(aDisp, GLX_VENDOR) << "\n";
-  std::cout << "[" << PlatformName() << "] GLXClientVersion:   " << glXGetClientString(aDisp, GLX_VERSION) << "\n";
-  if (theToPrintExtensions)
-  {
-    const char* aGlxExts = glXGetClientString(aDisp, GLX_EXTENSIONS);
-    std::cout << "[" << PlatformName() << "] GLXClient extensions:\n";
-    printExtensions(aGlxExts);
-  }
+  theReport.Sections |= RendererReport::Section_Platform;
+  theReport.PlatformLabelWidth = 19;
+  theReport.AddPlatformProperty("GLXDirectRendering", glXIsDirect(aDisp, (GLXContext )myRendCtx) ? "Yes" : "No");
+  theReport.AddPlatformProperty("GLXVendor",  glXQueryServerString(aDisp, aScreen, GLX_VENDOR));
+  theReport.AddPlatformProperty("GLXVersion", glXQueryServerString(aDisp, aScreen, GLX_VERSION));
+  if (theToCollectExtensions)
+    theReport.AddPlatformExtensions("GLXExtensions", "GLX extensions", glXQueryExtensionsString(aDisp, aScreen));
+
+  theReport.AddPlatformProperty("GLXClientVendor",  glXGetClientString(aDisp, GLX_VENDOR));
+  theReport.AddPlatformProperty("GLXClientVersion", glXGetClientString(aDisp, GLX_VERSION));
+  if (theToCollectExtensions)
+    theReport.AddPlatformExtensions("GLXClientExtensions", "GLXClient extensions", glXGetClientString(aDisp, GLX_EXTENSIONS));
 }
 
-void GlxContext::PrintGpuMemoryInfo()
+void GlxContext::CollectGpuMemoryInfo(RendererReport& theReport)
 {
-  BaseGlContext::PrintGpuMemoryInfo();
+  BaseGlContext::CollectGpuMemoryInfo(theReport);
 
   // Mesa implements other extensions - no need to use GLX_MESA_query_renderer here
-  /*Display*    aDisp    = (Display*)myWin.GetDisplay();
-  const int   aScreen  = DefaultScreen(aDisp);
-  const char* aGlxExts = glXQueryExtensionsString(aDisp, aScreen);
-
-  typedef Bool (*glXQueryCurrentRendererIntegerMESAProc_t)(int attribute, unsigned int* value);
+  /*typedef Bool (*glXQueryCurrentRendererIntegerMESAProc_t)(int attribute, unsigned int* value);
   glXQueryCurrentRendererIntegerMESAProc_t aQueryMESAProc = NULL;
-  if (hasExtension(aGlxExts, "GLX_MESA_query_renderer")
+  if (glxExtensions().Has("GLX_MESA_query_renderer")
    && FindProc("glXQueryCurrentRendererIntegerMESA", aQueryMESAProc))
   {
     unsigned int aVideoMemoryMB = 0;
     aQueryMESAProc(GLX_RENDERER_VIDEO_MEMORY_MESA, &aVideoMemoryMB);
-    std::cout << Prefix() << "Mesa GPU memory: " << aVideoMemoryMB << " MiB\n";
+    theReport.AddGpuMemory("mesaMiB", "Mesa GPU memory", (int )aVideoMemoryMB);
   }*/
 }
 
-void GlxContext::PrintVisuals(bool theIsVerbose)
+void GlxContext::CollectVisuals(RendererReport& theReport, bool theIsVerbose)
 {
-  (void)theIsVerbose;
-
   Display*  aDisp = (Display*)myWin.GetDisplay();
   const int aScreen = DefaultScreen(aDisp);
   if (aDisp == nullptr)
@@ -300,23 +400,20 @@ void GlxContext::PrintVisuals(bool theIsVerbose)
   int          aFBCount = 0;
   GLXFBConfig* aFBCfgList = glXGetFBConfigs(aDisp, aScreen, &aFBCount);
 
-  std::cout << "\n[" << PlatformName() << "] " << aFBCount << " GLXFB Configs\n";
-  if (!theIsVerbose)
-    VisualInfo::PrintTableHeader(true);
+  theReport.Sections |= RendererReport::Section_Visuals;
+  theReport.VisualsTitle = std::to_string(aFBCount) + " GLXFB Configs";
+  theReport.IsVerboseVisuals = theIsVerbose; // verbose form lists the same table without header
 
-  std::string aGlxExt;
-  if (const char* aGlxExtRaw = glXQueryExtensionsString(aDisp, aScreen))
-    aGlxExt = aGlxExtRaw;
-
-  const bool hasExtFloat = hasExtension(aGlxExt, "GLX_ARB_fbconfig_float");
-  const bool hasExtSrgb  = hasExtension(aGlxExt, "GLX_EXT_framebuffer_sRGB");
+  const ExtensionSet& aGlxExt = glxExtensions();
+  const bool hasExtFloat = aGlxExt.Has("GLX_ARB_fbconfig_float");
+  const bool hasExtSrgb  = aGlxExt.Has("GLX_EXT_framebuffer_sRGB");
 
   unsigned int isMesaAccel = 1;
 #ifdef GLX_RENDERER_ACCELERATED_MESA
   typedef Bool(*glXQueryRendererIntegerMESA_t)(Display *dpy, int screen, int renderer,
                                                int attribute, unsigned int *value);
   glXQueryRendererIntegerMESA_t aQueryRendererMesaI = nullptr;
-  if (hasExtension(aGlxExt, "GLX_MESA_query_renderer")
+  if (aGlxExt.Has("GLX_MESA_query_renderer")
    && FindProc("glXQueryRendererIntegerMESA", aQueryRendererMesaI))
     aQueryRendererMesaI(aDisp, aScreen, 0, GLX_RENDERER_ACCELERATED_MESA, &isMesaAccel); // 0x8186
 #endif
@@ -399,12 +496,9 @@ void GlxContext::PrintVisuals(bool theIsVerbose)
     //int aLevel = 0; // positive level for overlay
     //glXGetFBConfigAttrib(aDisp, anFBConfig, GLX_LEVEL, &aLevel);
 
-    anInfo.PrintTableLine();
+    theReport.Visuals.push_back(anInfo);
   }
   XFree(aFBCfgList);
-
-  if (!theIsVerbose)
-    VisualInfo::PrintTableHeader(false);
 }
 
 #endif
@@ -9,6 +9,8 @@
 #include "BaseGlContext.h"
 #include "XwWindow.h"
 
+#include <functional>
+
 //! GLX context (Xlib).
 class GlxContext : public BaseGlContext
 {
@@ -34,29 +36,17 @@ public:
 
 public:
 
-  //! Print GLX platform info.
-  virtual void PrintPlatformInfo(bool theToPrintExtensions) override;
+  //! Collect GLX platform info.
+  virtual void CollectPlatformInfo(RendererReport& theReport, bool theToCollectExtensions) override;
 
-  //! Print GPU memory info.
-  virtual void PrintGpuMemoryInfo() override;
+  //! Collect GPU memory info.
+  virtual void CollectGpuMemoryInfo(RendererReport& theReport) override;
 
-  //! Print information about visuals.
-  virtual void PrintVisuals(bool theIsVerbose) override;
+  //! Collect information about visuals.
+  virtual void CollectVisuals(RendererReport& theReport, bool theIsVerbose) override;
 
 public:
 
-  //! glGetError() wrapper.
-  virtual unsigned int GlGetError() override;
-
-  //! glGetString() wrapper.
-  virtual const char* GlGetString(unsigned int theGlEnum) override;
-
-  //! glGetStringi() wrapper.
-  virtual const char* GlGetStringi(unsigned int theGlEnum, unsigned int theIndex) override;
-
-  //! glGetIntegerv() wrapper.
-  virtual void GlGetIntegerv(unsigned int theGlEnum, int* theParams) override;
-
   //! Wrapper to system function to retrieve GL function pointer by name.
   virtual void* GlGetProcAddress(const char* theFuncName) override;
 
@@ -65,6 +55,30 @@ private:
   //! Release resources.
   void release();
 
+  //! Return GLX extensions of the screen, queried once per window.
+  const ExtensionSet& glxExtensions();
+
+private:
+
+  //! Information cached per X display.
+  struct DisplayCache
+  {
+    VersionHint Core;   //!< highest OpenGL version of core profile
+    VersionHint Compat; //!< highest OpenGL version of compatibility profile
+    bool IsQueried = false; //!< GLX_MESA_query_renderer has been queried
+    std::string Vendor;   //!< GL_VENDOR of the first created context
+    std::string Renderer; //!< GL_RENDERER of the first created context
+  };
+
+  //! Return a copy of information cached for the display of the window;
+  //! software and hardware renderers are cached separately.
+  //! Cache is shared by concurrent probes, so that it could be modified only by the functor called under lock.
+  //! @param theUpdate optional functor modifying cached information before returning its copy
+  DisplayCache displayCache(bool theIsSoft, const std::function<void(DisplayCache& )>& theUpdate = nullptr);
+
+  //! Remember renderer strings of current non-software context in display cache.
+  void rememberRenderer();
+
 private:
 
   typedef void* NativeRenderingContext; // GLXContext under UNIX
@@ -73,6 +87,8 @@ private:
 
   XwWindow myWin;
   NativeRenderingContext myRendCtx = 0; //!< GLXContext rendering context
+  ExtensionSet myGlxExts; //!< GLX extensions of the screen
+  bool myHasGlxExts = false;
 
 };
 
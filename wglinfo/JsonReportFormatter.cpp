@@ -0,0 +1,231 @@
+// Copyright © Kirill Gavrilov, 2026
+//
+// This code is licensed under MIT license (see LICENSE.txt for details).
+
+#include "JsonReportFormatter.h"
+
+#include "BaseGlContext.h"
+
+#include <cstdio>
+
+//! Return identifier of known extensions registry as hex string.
+static std::string registryId()
+{
+  char aBuffer[16];
+  snprintf(aBuffer, sizeof(aBuffer), "%08x", ExtensionBitset::RegistryId());
+  return aBuffer;
+}
+
+void JsonReportFormatter::BeginDocument(const std::string& theVersion,
+                                        const std::string& theArch,
+                                        const std::string& theAbout)
+{
+  myJson.BeginObject()
+        .Key("wglinfo").BeginObject()
+          .Value("version", theVersion)
+          .Value("arch", theArch)
+          .Value("about", theAbout)
+          .Value("extensionRegistry", registryId())
+        .EndObject()
+        .Key("platforms").BeginArray();
+  flushBuffer();
+}
+
+void JsonReportFormatter::EndDocument()
+{
+  myJson.EndArray().EndObject();
+  flushBuffer();
+}
+
+void JsonReportFormatter::BeginPlatform(const RendererReport& theInfo)
+{
+  myJson.BeginObject().Value("platform", theInfo.Platform);
+  if (theInfo.HasSection(RendererReport::Section_Platform))
+  {
+    myJson.Key("info").BeginObject();
+    for (const RendererReport::Property& aProp : theInfo.PlatformInfo)
+    {
+      myJson.Key(aProp.Key.c_str());
+      if (aProp.IsList)
+        writeExtensions(aProp.List, aProp.IsNull);
+      else if (aProp.IsNull)
+        myJson.Null();
+      else
+        myJson.String(aProp.Value);
+    }
+    myJson.EndObject();
+
+    ExtensionBitset aBits;
+    for (const RendererReport::Property& aProp : theInfo.PlatformInfo)
+      aBits.AddList(aProp.List);
+    writeExtensionBits(aBits);
+  }
+  myJson.Key("profiles").BeginArray();
+  flushBuffer();
+}
+
+void JsonReportFormatter::EndPlatform()
+{
+  myJson.EndArray().EndObject();
+  flushBuffer();
+}
+
+void JsonReportFormatter::WriteProfile(const RendererReport& theReport)
+{
+  const BaseGlContext::ContextBits aBits = (BaseGlContext::ContextBits )theReport.ContextBits;
+  myJson.BeginObject()
+        .Value("label", BaseGlContext::ProbeLabel(theReport.Platform.c_str(), aBits))
+        .Value("api", BaseGlContext::ApiName(aBits))
+        .Value("profile", BaseGlContext::ProfileName(aBits));
+
+  if (theReport.HasSection(RendererReport::Section_Renderer))
+  {
+    myJson.Key("renderer").BeginObject()
+          .Value("vendor",   theReport.Vendor)
+          .Value("renderer", theReport.Renderer)
+          .Value("version",  theReport.Version);
+    if (theReport.HasShadingLanguageVersion)
+      myJson.Value("shadingLanguageVersion", theReport.ShadingLanguageVersion);
+    myJson.EndObject();
+  }
+
+  if (theReport.HasSection(RendererReport::Section_GpuMemory))
+  {
+    myJson.Key("gpuMemory").BeginObject();
+    for (const RendererReport::GpuMemory& aMem : theReport.GpuMemoryInfo)
+      myJson.Value(aMem.Key.c_str(), aMem.MiB);
+    myJson.EndObject();
+  }
+
+  if (theReport.HasSection(RendererReport::Section_Extensions))
+  {
+    myJson.Key("extensions");
+    writeExtensions(theReport.Extensions, false);
+
+    ExtensionBitset aBits;
+    aBits.AddList(theReport.Extensions);
+    writeExtensionBits(aBits);
+  }
+
+  if (theReport.HasSection(RendererReport::Section_Limits))
+  {
+    myJson.Key("limits").BeginObject();
+    for (const RendererReport::Limit& aLim : theReport.Limits)
+    {
+      if (aLim.NbVals == 2)
+        myJson.Key(aLim.Name.c_str()).BeginArray().Int(aLim.Values[0]).Int(aLim.Values[1]).EndArray();
+      else
+        myJson.Value(aLim.Name.c_str(), aLim.Values[0]);
+    }
+    if (!theReport.ShadingLanguageVersions.empty())
+    {
+      myJson.Key("GL_SHADING_LANGUAGE_VERSION");
+      writeExtensions(theReport.ShadingLanguageVersions, false);
+    }
+    myJson.EndObject();
+  }
+
+  myJson.EndObject();
+  flushBuffer();
+}
+
+void JsonReportFormatter::BeginVisualsList()
+{
+  myJson.EndArray().Key("visuals").BeginArray();
+  flushBuffer();
+}
+
+void JsonReportFormatter::WriteVisuals(const RendererReport& theReport)
+{
+  if (!theReport.HasSection(RendererReport::Section_Visuals))
+    return;
+
+  myJson.BeginObject()
+        .Value("platform", theReport.Platform)
+        .Value("title", theReport.VisualsTitle)
+        .Key("visuals").BeginArray();
+  for (size_t aVisIter = 0; aVisIter < theReport.Visuals.size(); ++aVisIter)
+  {
+    WriteVisual(myJson, theReport.Visuals[aVisIter],
+                aVisIter < theReport.VisualDetails.size() ? theReport.VisualDetails[aVisIter] : std::string());
+  }
+  myJson.EndArray().EndObject();
+  flushBuffer();
+}
+
+void JsonReportFormatter::writeExtensions(const std::vector<std::string>& theList, bool theIsNull)
+{
+  if (theIsNull)
+  {
+    myJson.Null();
+    return;
+  }
+
+  myJson.BeginArray();
+  for (const std::string& anExt : theList)
+    myJson.String(anExt);
+  myJson.EndArray();
+}
+
+void JsonReportFormatter::writeExtensionBits(const ExtensionBitset& theBits)
+{
+  myJson.Value("extensionBits", theBits.ToHex())
+        .Key("unknownExtensions");
+  writeExtensions(theBits.Unknown(), false);
+}
+
+void JsonReportFormatter::WriteVisual(JsonWriter& theWriter,
+                                      const RendererReport::VisualInfo& theInfo,
+                                      const std::string& theDetails)
+{
+  typedef RendererReport::VisualInfo VisualInfo;
+  static const char* THE_BUFFER_TYPES[] = { "color_index", "luminance", "rgba" };
+
+  theWriter.BeginObject()
+           .Value("ConfigId", theInfo.ConfigId)
+           .Key("ConfigCaveat").BeginArray();
+  if ((theInfo.ConfigCaveat & VisualInfo::Caveat_Slow) != 0)
+    theWriter.String("slow");
+  if ((theInfo.ConfigCaveat & VisualInfo::Caveat_NonConformant) != 0)
+    theWriter.String("non_conformant");
+  theWriter.EndArray()
+           .Value("IsSoftware", theInfo.IsSoftware)
+           .Value("BufferType", THE_BUFFER_TYPES[theInfo.BufferType])
+           .Value("IsColorFloat", theInfo.IsColorFloat)
+           .Key("SurfaceType").BeginArray();
+  if ((theInfo.SurfaceType & VisualInfo::Surface_Window) != 0)
+    theWriter.String("window");
+  if ((theInfo.SurfaceType & VisualInfo::Surface_Pixmap) != 0)
+    theWriter.String("pixmap");
+  if ((theInfo.SurfaceType & VisualInfo::Surface_PBuffer) != 0)
+    theWriter.String("pbuffer");
+  if ((theInfo.SurfaceType & VisualInfo::Surface_PBufferRemote) != 0)
+    theWriter.String("pbuffer_remote");
+  theWriter.EndArray()
+           .Value("ColorDepth", theInfo.ColorDepth)
+           .Value("ColorBufferSize", theInfo.ColorBufferSize)
+           .Value("LuminanceSize", theInfo.LuminanceSize)
+           .Value("RedSize", theInfo.RedSize)
+           .Value("GreenSize", theInfo.GreenSize)
+           .Value("BlueSize", theInfo.BlueSize)
+           .Value("AlphaSize", theInfo.AlphaSize)
+           .Value("DepthSize", theInfo.DepthSize)
+           .Value("StencilSize", theInfo.StencilSize)
+           .Value("SwapIntervalMin", theInfo.SwapIntervalMin)
+           .Value("SwapIntervalMax", theInfo.SwapIntervalMax)
+           .Value("IsStereoBuffer", theInfo.IsStereoBuffer)
+           .Value("IsSRgb", theInfo.IsSRgb)
+           .Value("NbAuxBuffers", theInfo.NbAuxBuffers)
+           .Value("AccumRedSize", theInfo.AccumRedSize)
+           .Value("AccumGreenSize", theInfo.AccumGreenSize)
+           .Value("AccumBlueSize", theInfo.AccumBlueSize)
+           .Value("AccumAlphaSize", theInfo.AccumAlphaSize)
+           .Value("NbSampleBuffers", theInfo.NbSampleBuffers)
+           .Value("NbSamples", theInfo.NbSamples)
+           .Value("LayerLevel", theInfo.LayerLevel)
+           .Value("NbLayersUnderlay", theInfo.NbLayersUnderlay)
+           .Value("NbLayersOverlay", theInfo.NbLayersOverlay);
+  if (!theDetails.empty())
+    theWriter.Value("details", theDetails);
+  theWriter.EndObject();
+}
@@ -0,0 +1,73 @@
+// Copyright © Kirill Gavrilov, 2026
+//
+// This code is licensed under MIT license (see LICENSE.txt for details).
+
+#ifndef JSONREPORTFORMATTER_HEADER
+#define JSONREPORTFORMATTER_HEADER
+
+#include "ReportFormatter.h"
+#include "JsonWriter.h"
+#include "ExtensionBitset.h"
+
+//! Formatter of report as a single JSON document:
+//! {"wglinfo":{...},"platforms":[{"platform","info","profiles":[...]}],"visuals":[...]}.
+//! Entries written without BeginDocument() become standalone JSON values (fragments).
+class JsonReportFormatter : public ReportFormatter
+{
+public:
+
+  //! Main constructor.
+  JsonReportFormatter(std::ostream& theStream) : ReportFormatter(theStream), myJson(myBuffer) {}
+
+  //! Open document object, write tool information and open platforms array.
+  virtual void BeginDocument(const std::string& theVersion,
+                             const std::string& theArch,
+                             const std::string& theAbout) override;
+
+  //! Close visuals array and document object.
+  virtual void EndDocument() override;
+
+  //! Open platform object with platform info and profiles array.
+  virtual void BeginPlatform(const RendererReport& theInfo) override;
+
+  //! Close platform object.
+  virtual void EndPlatform() override;
+
+  //! Write profile object.
+  virtual void WriteProfile(const RendererReport& theReport) override;
+
+  //! Close platforms array and open visuals array.
+  virtual void BeginVisualsList() override;
+
+  //! Write visuals object.
+  virtual void WriteVisuals(const RendererReport& theReport) override;
+
+  //! Write JSON value produced by another formatter.
+  virtual void WriteFragment(const std::string& theFragment) override
+  {
+    myJson.Raw(theFragment);
+    flushBuffer();
+  }
+
+public:
+
+  //! Write visual as JSON object with all fields.
+  static void WriteVisual(JsonWriter& theWriter,
+                          const RendererReport::VisualInfo& theInfo,
+                          const std::string& theDetails = std::string());
+
+private:
+
+  //! Write extensions as JSON array of strings.
+  void writeExtensions(const std::vector<std::string>& theList, bool theIsNull);
+
+  //! Write compact bitset form of extensions ("extensionBits" and "unknownExtensions").
+  void writeExtensionBits(const ExtensionBitset& theBits);
+
+private:
+
+  JsonWriter myJson;
+
+};
+
+#endif // JSONREPORTFORMATTER_HEADER
@@ -0,0 +1,151 @@
+// Copyright © Kirill Gavrilov, 2026
+//
+// This code is licensed under MIT license (see LICENSE.txt for details).
+
+#include "JsonWriter.h"
+
+namespace
+{
+  //! Write string as JSON literal into the stream or buffer.
+  template<typename Stream_t>
+  static void writeJsonString(Stream_t& theStream, const char* theStr)
+  {
+    static const char THE_HEX[] = "0123456789abcdef";
+    theStream << '"';
+    for (const char* aCharIter = theStr; *aCharIter != '\0'; ++aCharIter)
+    {
+      const char aChar = *aCharIter;
+      switch (aChar)
+      {
+        case '"':  theStream << "\\\""; break;
+        case '\\': theStream << "\\\\"; break;
+        case '\n': theStream << "\\n";  break;
+        case '\r': theStream << "\\r";  break;
+        case '\t': theStream << "\\t";  break;
+        default:
+        {
+          if ((unsigned char)aChar < 0x20)
+            theStream << "\\u00" << THE_HEX[(aChar >> 4) & 0x0F] << THE_HEX[aChar & 0x0F];
+          else
+            theStream << aChar;
+          break;
+        }
+      }
+    }
+    theStream << '"';
+  }
+}
+
+void JsonWriter::WriteString(std::ostream& theStream, const char* theStr)
+{
+  writeJsonString(theStream, theStr);
+}
+
+void JsonWriter::WriteString(OutputBuffer& theBuffer, const char* theStr)
+{
+  writeJsonString(theBuffer, theStr);
+}
+
+void JsonWriter::beforeValue()
+{
+  if (myIsAfterKey)
+  {
+    myIsAfterKey = false;
+    return;
+  }
+
+  if (!myLevels.empty())
+  {
+    if (myLevels.back())
+      myBuffer << ',';
+    myLevels.back() = true;
+  }
+}
+
+JsonWriter& JsonWriter::BeginObject()
+{
+  beforeValue();
+  myBuffer << '{';
+  myLevels.push_back(false);
+  return *this;
+}
+
+JsonWriter& JsonWriter::EndObject()
+{
+  myBuffer << '}';
+  myLevels.pop_back();
+  if (myLevels.empty())
+    myBuffer << '\n';
+  return *this;
+}
+
+JsonWriter& JsonWriter::BeginArray()
+{
+  beforeValue();
+  myBuffer << '[';
+  myLevels.push_back(false);
+  return *this;
+}
+
+JsonWriter& JsonWriter::EndArray()
+{
+  myBuffer << ']';
+  myLevels.pop_back();
+  if (myLevels.empty())
+    myBuffer << '\n';
+  return *this;
+}
+
+JsonWriter& JsonWriter::Key(const char* theKey)
+{
+  beforeValue();
+  WriteString(myBuffer, theKey);
+  myBuffer << ':';
+  myIsAfterKey = true;
+  return *this;
+}
+
+JsonWriter& JsonWriter::String(const char* theStr)
+{
+  if (theStr == nullptr)
+    return Null();
+
+  beforeValue();
+  WriteString(myBuffer, theStr);
+  return *this;
+}
+
+JsonWriter& JsonWriter::Int(long long theVal)
+{
+  beforeValue();
+  myBuffer.AppendInt(theVal);
+  return *this;
+}
+
+JsonWriter& JsonWriter::Bool(bool theVal)
+{
+  beforeValue();
+  myBuffer << (theVal ? "true" : "false");
+  return *this;
+}
+
+JsonWriter& JsonWriter::Null()
+{
+  beforeValue();
+  myBuffer << "null";
+  return *this;
+}
+
+JsonWriter& JsonWriter::Raw(const std::string& theJson)
+{
+  // strip trailing new line put after top-level value
+  size_t aLen = theJson.size();
+  while (aLen > 0 && theJson[aLen - 1] == '\n')
+    --aLen;
+  if (aLen == 0)
+    return myIsAfterKey ? Null() : *this;
+
+  beforeValue();
+  myBuffer.Append(theJson.data(), aLen);
+  return *this;
+}
@@ -0,0 +1,95 @@
+// Copyright © Kirill Gavrilov, 2026
+//
+// This code is licensed under MIT license (see LICENSE.txt for details).
+
+#ifndef JSONWRITER_HEADER
+#define JSONWRITER_HEADER
+
+#include "OutputBuffer.h"
+
+#include <ostream>
+#include <string>
+#include <vector>
+
+//! Streaming writer of compact JSON document.
+//! Values are written directly into the output buffer without building the document tree in memory;
+//! the writer tracks only nesting level to put separators.
+class JsonWriter
+{
+public:
+
+  //! Constructor.
+  JsonWriter(OutputBuffer& theBuffer) : myBuffer(theBuffer) {}
+
+  //! Return output buffer.
+  OutputBuffer& Buffer() { return myBuffer; }
+
+  //! Return TRUE if top-level value is not yet opened or has been already closed.
+  bool IsTopLevel() const { return myLevels.empty(); }
+
+  //! Open object.
+  JsonWriter& BeginObject();
+
+  //! Close object.
+  JsonWriter& EndObject();
+
+  //! Open array.
+  JsonWriter& BeginArray();
+
+  //! Close array.
+  JsonWriter& EndArray();
+
+  //! Write object member name; should be followed by value.
+  JsonWriter& Key(const char* theKey);
+
+  //! Write string value (NULL is written as null).
+  JsonWriter& String(const char* theStr);
+
+  //! Write string value.
+  JsonWriter& String(const std::string& theStr) { return String(theStr.c_str()); }
+
+  //! Write integer value.
+  JsonWriter& Int(long long theVal);
+
+  //! Write boolean value.
+  JsonWriter& Bool(bool theVal);
+
+  //! Write null value.
+  JsonWriter& Null();
+
+  //! Write already formatted JSON value (e.g. produced by another writer);
+  //! empty string is ignored within array and written as null for object member.
+  JsonWriter& Raw(const std::string& theJson);
+
+  //! Write object member with string value.
+  JsonWriter& Value(const char* theKey, const char* theStr) { return Key(theKey).String(theStr); }
+
+  //! Write object member with string value.
+  JsonWriter& Value(const char* theKey, const std::string& theStr) { return Key(theKey).String(theStr); }
+
+  //! Write object member with integer value.
+  JsonWriter& Value(const char* theKey, int theVal) { return Key(theKey).Int(theVal); }
+
+  //! Write object member with boolean value.
+  JsonWriter& Value(const char* theKey, bool theVal) { return Key(theKey).Bool(theVal); }
+
+  //! Write string as JSON literal.
+  static void WriteString(std::ostream& theStream, const char* theStr);
+
+  //! Write string as JSON literal.
+  static void WriteString(OutputBuffer& theBuffer, const char* theStr);
+
+private:
+
+  //! Put separator before the next value.
+  void beforeValue();
+
+private:
+
+  OutputBuffer& myBuffer;
+  std::vector<bool> myLevels; //!< flags indicating that container at nesting level has items
+  bool myIsAfterKey = false;
+
+};
+
+#endif // JSONWRITER_HEADER
@@ -0,0 +1,56 @@
+// Copyright © Kirill Gavrilov, 2026
+//
+// This code is licensed under MIT license (see LICENSE.txt for details).
+
+#include "OutputBuffer.h"
+
+void OutputBuffer::Flush(std::ostream& theStream)
+{
+  if (!myData.empty())
+    theStream.write(myData.data(), (std::streamsize)myData.size());
+  theStream.flush();
+  myData.clear();
+}
+
+OutputBuffer& OutputBuffer::AppendInt(long long theVal, int theWidth, char theFill)
+{
+  // digits are filled from the end of local buffer
+  char aBuffer[32];
+  char* anEnd = aBuffer + sizeof(aBuffer);
+  char* aStart = anEnd;
+  unsigned long long aVal = theVal < 0 ? 0ULL - (unsigned long long)theVal : (unsigned long long)theVal;
+  do
+  {
+    *--aStart = char('0' + aVal % 10);
+    aVal /= 10;
+  }
+  while (aVal != 0);
+  if (theVal < 0)
+    *--aStart = '-';
+
+  const int aLen = int(anEnd - aStart);
+  if (aLen < theWidth)
+    myData.append(size_t(theWidth - aLen), theFill);
+  myData.append(aStart, size_t(aLen));
+  return *this;
+}
+
+OutputBuffer& OutputBuffer::AppendHex(unsigned long long theVal, int theWidth, char theFill)
+{
+  static const char THE_HEX[] = "0123456789abcdef";
+  char aBuffer[32];
+  char* anEnd = aBuffer + sizeof(aBuffer);
+  char* aStart = anEnd;
+  do
+  {
+    *--aStart = THE_HEX[theVal & 0x0F];
+    theVal >>= 4;
+  }
+  while (theVal != 0);
+
+  const int aLen = int(anEnd - aStart);
+  if (aLen < theWidth)
+    myData.append(size_t(theWidth - aLen), theFill);
+  myData.append(aStart, size_t(aLen));
+  return *this;
+}
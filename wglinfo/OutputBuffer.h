@@ -0,0 +1,91 @@
+// Copyright © Kirill Gavrilov, 2026
+//
+// This code is licensed under MIT license (see LICENSE.txt for details).
+
+#ifndef OUTPUTBUFFER_HEADER
+#define OUTPUTBUFFER_HEADER
+
+#include <cstring>
+#include <ostream>
+#include <string>
+
+//! Reusable output buffer accumulating a report section before writing it into the stream at once.
+//! Integers are formatted without iostream machinery (locale-free, no per-call allocations),
+//! and the memory is kept between flushes, so that printing large tables
+//! costs a single write instead of a write per line.
+class OutputBuffer
+{
+public:
+
+  //! Empty constructor.
+  OutputBuffer() { myData.reserve(16384); }
+
+  //! Return buffered data.
+  const char* Data() const { return myData.data(); }
+
+  //! Return buffered data size.
+  size_t Size() const { return myData.size(); }
+
+  //! Return TRUE if buffer is empty.
+  bool IsEmpty() const { return myData.empty(); }
+
+  //! Return buffered data as string.
+  const std::string& String() const { return myData; }
+
+  //! Discard buffered data keeping allocated memory.
+  void Clear() { myData.clear(); }
+
+  //! Write buffered data into the stream, flush the stream and clear the buffer.
+  void Flush(std::ostream& theStream);
+
+  //! Append characters.
+  OutputBuffer& Append(const char* theStr, size_t theLen)
+  {
+    myData.append(theStr, theLen);
+    return *this;
+  }
+
+  //! Append the character repeated specified number of times.
+  OutputBuffer& Append(size_t theCount, char theChar)
+  {
+    myData.append(theCount, theChar);
+    return *this;
+  }
+
+  //! Append decimal integer right-aligned to specified width (like std::setw()).
+  OutputBuffer& AppendInt(long long theVal, int theWidth = 0, char theFill = ' ');
+
+  //! Append lower-case hexadecimal integer right-aligned to specified width.
+  OutputBuffer& AppendHex(unsigned long long theVal, int theWidth = 0, char theFill = '0');
+
+  //! Append string.
+  OutputBuffer& operator<<(const std::string& theStr) { return Append(theStr.data(), theStr.size()); }
+
+  //! Append null-terminated string.
+  OutputBuffer& operator<<(const char* theStr) { return Append(theStr, strlen(theStr)); }
+
+  //! Append character.
+  OutputBuffer& operator<<(char theChar)
+  {
+    myData.push_back(theChar);
+    return *this;
+  }
+
+  //! Append decimal integer.
+  OutputBuffer& operator<<(int theVal) { return AppendInt(theVal); }
+
+  //! Append decimal integer.
+  OutputBuffer& operator<<(long long theVal) { return AppendInt(theVal); }
+
+private:
+
+  OutputBuffer(const OutputBuffer& ) = delete;
+  OutputBuffer& operator=(const OutputBuffer& ) = delete;
+
+private:
+
+  std::string myData;
+
+};
+
+#endif // OUTPUTBUFFER_HEADER
@@ -0,0 +1,305 @@
+// Copyright © Kirill Gavrilov, 2026
+//
+// This code is licensed under MIT license (see LICENSE.txt for details).
+
+#include "ProbeIsolator.h"
+
+#include "BinaryData.h"
+
+#if !defined(_WIN32) && !defined(__EMSCRIPTEN__)
+  #include <cerrno>
+  #include <csignal>
+  #include <cstring>
+  #include <poll.h>
+  #include <sys/types.h>
+  #include <sys/wait.h>
+  #include <unistd.h>
+#endif
+
+#if defined(_WIN32) && !defined(__EMSCRIPTEN__)
+  #include <thread>
+#endif
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <iostream>
+
+//! Serialized data signature and version.
+static const char THE_PROBE_MAGIC[4] = { 'W', 'G', 'L', '1' };
+
+void ProbeResult::Serialize(std::string& theData) const
+{
+  theData.assign(THE_PROBE_MAGIC, sizeof(THE_PROBE_MAGIC));
+  BinaryData::WriteUInt32(theData, (uint32_t)State);
+  BinaryData::WriteUInt32(theData, (uint32_t)Bits);
+  BinaryData::WriteString(theData, Platform);
+  BinaryData::WriteString(theData, Report);
+  BinaryData::WriteString(theData, Details);
+}
+
+bool ProbeResult::Deserialize(const std::string& theData)
+{
+  if (theData.size() < sizeof(THE_PROBE_MAGIC)
+   || theData.compare(0, sizeof(THE_PROBE_MAGIC), THE_PROBE_MAGIC, sizeof(THE_PROBE_MAGIC)) != 0)
+  {
+    return false;
+  }
+
+  size_t aPos = sizeof(THE_PROBE_MAGIC);
+  uint32_t aState = 0, aBits = 0;
+  if (!BinaryData::ReadUInt32(theData, aPos, aState)
+   || !BinaryData::ReadUInt32(theData, aPos, aBits)
+   || aState > Status_Crashed
+   || !BinaryData::ReadString(theData, aPos, Platform)
+   || !BinaryData::ReadString(theData, aPos, Report)
+   || !BinaryData::ReadString(theData, aPos, Details))
+  {
+    return false;
+  }
+
+  State = (Status)aState;
+  Bits  = (int)aBits;
+  return aPos == theData.size();
+}
+
+bool ProbeIsolator::IsSupported()
+{
+#if !defined(_WIN32) && !defined(__EMSCRIPTEN__)
+  return true;
+#else
+  return false;
+#endif
+}
+
+#if !defined(_WIN32) && !defined(__EMSCRIPTEN__)
+
+namespace
+{
+  //! Running child process.
+  struct ChildProcess
+  {
+    pid_t       Pid  = -1;
+    int         Pipe = -1;
+    size_t      Index = 0;
+    std::string Data;
+    std::chrono::steady_clock::time_point Start;
+  };
+
+  //! Write whole buffer into file descriptor.
+  static bool writeAll(int theFd, const std::string& theData)
+  {
+    size_t aWritten = 0;
+    while (aWritten < theData.size())
+    {
+      const ssize_t aRes = ::write(theFd, theData.data() + aWritten, theData.size() - aWritten);
+      if (aRes < 0)
+      {
+        if (errno == EINTR)
+          continue;
+        return false;
+      }
+      aWritten += size_t(aRes);
+    }
+    return true;
+  }
+
+  //! Launch probe in a child process.
+  static bool launchChild(const ProbeIsolator::Probe& theProbe, ChildProcess& theChild)
+  {
+    int aPipe[2] = { -1, -1 };
+    if (::pipe(aPipe) != 0)
+    {
+      std::cerr << "Error: unable to create pipe for probe process\n";
+      return false;
+    }
+
+    // flush buffers to avoid duplicated output from child
+    std::cout.flush();
+    std::cerr.flush();
+    fflush(stdout);
+
+    const pid_t aPid = ::fork();
+    if (aPid < 0)
+    {
+      std::cerr << "Error: unable to fork probe process\n";
+      ::close(aPipe[0]);
+      ::close(aPipe[1]);
+      return false;
+    }
+
+    if (aPid == 0)
+    {
+      // child process - run probe and send result back
+      ::close(aPipe[0]);
+      ProbeResult aResult;
+      theProbe(aResult);
+
+      std::string aData;
+      aResult.Serialize(aData);
+      const bool isSent = writeAll(aPipe[1], aData);
+      ::close(aPipe[1]);
+      std::cerr.flush();
+      ::_exit(isSent ? 0 : 1);
+    }
+
+    ::close(aPipe[1]);
+    theChild.Pid   = aPid;
+    theChild.Pipe  = aPipe[0];
+    theChild.Start = std::chrono::steady_clock::now();
+    theChild.Data.clear();
+    return true;
+  }
+
+  //! Reap finished (or killed) child and fill result.
+  static void finishChild(ChildProcess& theChild, bool theIsTimeout, int theTimeoutMs, ProbeResult& theResult)
+  {
+    if (theIsTimeout)
+      ::kill(theChild.Pid, SIGKILL);
+
+    ::close(theChild.Pipe);
+    theChild.Pipe = -1;
+
+    int aStatus = 0;
+    while (::waitpid(theChild.Pid, &aStatus, 0) < 0 && errno == EINTR) {}
+
+    theResult.ElapsedMs = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - theChild.Start).count();
+    if (theIsTimeout)
+    {
+      theResult.State   = ProbeResult::Status_Timeout;
+      theResult.Details = std::string("no response within ") + std::to_string(theTimeoutMs) + " ms";
+      return;
+    }
+
+    if (WIFSIGNALED(aStatus))
+    {
+      const int aSignal = WTERMSIG(aStatus);
+      theResult.State   = ProbeResult::Status_Crashed;
+      theResult.Details = std::string("terminated by signal ") + std::to_string(aSignal);
+      if (const char* aSigName = ::strsignal(aSignal))
+        theResult.Details += std::string(" (") + aSigName + ")";
+      return;
+    }
+
+    const double anElapsedMs = theResult.ElapsedMs;
+    if (!theResult.Deserialize(theChild.Data))
+    {
+      theResult = ProbeResult();
+      theResult.State     = ProbeResult::Status_Crashed;
+      theResult.Details   = WIFEXITED(aStatus)
+                          ? std::string("exited with code ") + std::to_string(WEXITSTATUS(aStatus)) + " without result"
+                          : std::string("malformed result");
+    }
+    theResult.ElapsedMs = anElapsedMs;
+  }
+}
+
+std::vector<ProbeResult> ProbeIsolator::RunAll(const std::vector<Probe>& theProbes, int theNbJobs)
+{
+  std::vector<ProbeResult> aResults(theProbes.size());
+  const size_t aNbJobs = theNbJobs > 1 ? size_t(theNbJobs) : 1;
+
+  std::vector<ChildProcess> aRunning;
+  size_t aNextProbe = 0;
+  for (;;)
+  {
+    // launch new children up to the jobs limit
+    while (aNextProbe < theProbes.size() && aRunning.size() < aNbJobs)
+    {
+      ChildProcess aChild;
+      aChild.Index = aNextProbe++;
+      if (!launchChild(theProbes[aChild.Index], aChild))
+      {
+        aResults[aChild.Index].State   = ProbeResult::Status_Crashed;
+        aResults[aChild.Index].Details = "unable to launch probe process";
+        continue;
+      }
+      aRunning.push_back(aChild);
+    }
+    if (aRunning.empty())
+      break;
+
+    // wait for data or nearest deadline
+    const std::chrono::steady_clock::time_point aNow = std::chrono::steady_clock::now();
+    int aWaitMs = myTimeoutMs;
+    std::vector<pollfd> aPollFds(aRunning.size());
+    for (size_t aChildIter = 0; aChildIter < aRunning.size(); ++aChildIter)
+    {
+      const int aLeftMs = myTimeoutMs - (int)std::chrono::duration_cast<std::chrono::milliseconds>(aNow - aRunning[aChildIter].Start).count();
+      aWaitMs = std::min(aWaitMs, std::max(aLeftMs, 0));
+      aPollFds[aChildIter].fd = aRunning[aChildIter].Pipe;
+      aPollFds[aChildIter].events = POLLIN;
+      aPollFds[aChildIter].revents = 0;
+    }
+
+    const int aNbReady = ::poll(aPollFds.data(), (nfds_t)aPollFds.size(), aWaitMs);
+    if (aNbReady < 0 && errno != EINTR)
+    {
+      std::cerr << "Error: poll() on probe processes has failed\n";
+      aWaitMs = 0;
+    }
+
+    const std::chrono::steady_clock::time_point anAfter = std::chrono::steady_clock::now();
+    for (size_t aChildIter = aRunning.size(); aChildIter > 0; --aChildIter)
+    {
+      ChildProcess& aChild = aRunning[aChildIter - 1];
+      bool isDone = false, isTimeout = false;
+      if ((aPollFds[aChildIter - 1].revents & (POLLIN | POLLHUP | POLLERR)) != 0)
+      {
+        char aBuffer[4096];
+        const ssize_t aNbRead = ::read(aChild.Pipe, aBuffer, sizeof(aBuffer));
+        if (aNbRead > 0)
+          aChild.Data.append(aBuffer, size_t(aNbRead));
+        else if (aNbRead == 0 || errno != EINTR)
+          isDone = true; // EOF
+      }
+      if (!isDone
+       && std::chrono::duration_cast<std::chrono::milliseconds>(anAfter - aChild.Start).count() >= myTimeoutMs)
+      {
+        isDone = isTimeout = true;
+      }
+
+      if (isDone)
+      {
+        finishChild(aChild, isTimeout, myTimeoutMs, aResults[aChild.Index]);
+        aRunning.erase(aRunning.begin() + (aChildIter - 1));
+      }
+    }
+  }
+  return aResults;
+}
+
+#else
+
+std::vector<ProbeResult> ProbeIsolator::RunAll(const std::vector<Probe>& theProbes, int theNbJobs)
+{
+  // no fork() - execute probes in-process (on worker threads, if requested), deadline is not enforced
+  std::vector<ProbeResult> aResults(theProbes.size());
+  std::atomic<size_t> aNextProbe(0);
+  auto aWorker = [&theProbes, &aResults, &aNextProbe]()
+  {
+    for (size_t aProbeIter = aNextProbe++; aProbeIter < theProbes.size(); aProbeIter = aNextProbe++)
+    {
+      const std::chrono::steady_clock::time_point aStart = std::chrono::steady_clock::now();
+      theProbes[aProbeIter](aResults[aProbeIter]);
+      aResults[aProbeIter].ElapsedMs = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - aStart).count();
+    }
+  };
+
+#if defined(__EMSCRIPTEN__)
+  (void )theNbJobs;
+  aWorker();
+#else
+  std::vector<std::thread> aThreads;
+  const size_t aNbThreads = std::min(theNbJobs > 1 ? size_t(theNbJobs) : 1, theProbes.size());
+  for (size_t aThreadIter = 0; aThreadIter < aNbThreads; ++aThreadIter)
+    aThreads.emplace_back(aWorker);
+  for (std::thread& aThread : aThreads)
+    aThread.join();
+#endif
+  return aResults;
+}
+
+#endif
@@ -0,0 +1,93 @@
+// Copyright © Kirill Gavrilov, 2026
+//
+// This code is licensed under MIT license (see LICENSE.txt for details).
+
+#ifndef PROBEISOLATOR_HEADER
+#define PROBEISOLATOR_HEADER
+
+#include <functional>
+#include <string>
+#include <vector>
+
+//! Result of a single (platform, profile) probe.
+struct ProbeResult
+{
+  //! Probe status.
+  enum Status
+  {
+    Status_Ok = 0,  //!< context has been created and info printed
+    Status_Failed,  //!< context creation has failed
+    Status_Timeout, //!< probe has been killed after deadline
+    Status_Crashed, //!< probe process has been terminated abnormally
+  };
+
+  Status      State = Status_Failed; //!< probe status
+  int         Bits  = 0;             //!< context bits (BaseGlContext::ContextBits)
+  std::string Platform;              //!< printed platform info
+  std::string Report;                //!< printed renderer info
+  std::string Details;               //!< failure details (signal, exit code, etc.)
+  double      ElapsedMs = 0.0;       //!< probe wall time
+
+  //! Return status name.
+  static const char* StatusName(Status theStatus)
+  {
+    switch (theStatus)
+    {
+      case Status_Ok:      return "ok";
+      case Status_Failed:  return "failed";
+      case Status_Timeout: return "timeout";
+      case Status_Crashed: return "crashed";
+    }
+    return "unknown";
+  }
+
+  //! Serialize result into compact binary form.
+  void Serialize(std::string& theData) const;
+
+  //! Deserialize result from binary form; returns FALSE on malformed data.
+  bool Deserialize(const std::string& theData);
+};
+
+//! Tool running probes in forked child processes with a per-probe deadline,
+//! so that a wedged or crashing driver cannot hang or bring down the whole tool.
+//! The child sends the result back to the parent over a pipe.
+//! Several probes could be executed concurrently, while results are returned in the original order.
+//! Falls back to in-process execution on platforms without fork() (Windows, Emscripten),
+//! using worker threads for concurrent probes and without deadline.
+class ProbeIsolator
+{
+public:
+
+  //! Probe functor filling the result.
+  typedef std::function<void(ProbeResult& )> Probe;
+
+  //! Return TRUE if probes are executed in child processes on this platform.
+  static bool IsSupported();
+
+public:
+
+  //! Constructor.
+  //! @param[in] theTimeoutMs per-probe deadline in milliseconds
+  ProbeIsolator(int theTimeoutMs) : myTimeoutMs(theTimeoutMs) {}
+
+  //! Return per-probe deadline in milliseconds.
+  int TimeoutMs() const { return myTimeoutMs; }
+
+  //! Run single probe.
+  ProbeResult Run(const Probe& theProbe)
+  {
+    std::vector<Probe> aProbes(1, theProbe);
+    return RunAll(aProbes, 1).front();
+  }
+
+  //! Run probes with up to theNbJobs child processes at once.
+  //! @return results in the order of input probes
+  std::vector<ProbeResult> RunAll(const std::vector<Probe>& theProbes, int theNbJobs);
+
+private:
+
+  int myTimeoutMs = 10000;
+
+};
+
+#endif // PROBEISOLATOR_HEADER
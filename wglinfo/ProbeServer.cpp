@@ -0,0 +1,346 @@
+// Copyright © Kirill Gavrilov, 2026
+//
+// This code is licensed under MIT license (see LICENSE.txt for details).
+
+#include "ProbeServer.h"
+
+#if !defined(_WIN32) && !defined(__EMSCRIPTEN__)
+  #include <cerrno>
+  #include <fcntl.h>
+  #include <poll.h>
+  #include <sys/socket.h>
+  #include <sys/stat.h>
+  #include <sys/un.h>
+  #include <unistd.h>
+#endif
+
+#include <algorithm>
+#include <csignal>
+#include <cstring>
+#include <iostream>
+#include <sstream>
+
+namespace
+{
+  //! Flag requesting serving loop to stop.
+  static volatile sig_atomic_t THE_TO_STOP = 0;
+
+  //! Maximum length of request line.
+  static const size_t THE_MAX_REQUEST = 4096;
+
+  //! Convert string to lower case.
+  static std::string toLowerCase(std::string theStr)
+  {
+    for (size_t aCharIter = 0; aCharIter < theStr.length(); ++aCharIter)
+      theStr[aCharIter] = (char)tolower(theStr[aCharIter]);
+    return theStr;
+  }
+
+#if !defined(_WIN32) && !defined(__EMSCRIPTEN__)
+  //! Signal handler stopping serving loop.
+  static void onStopSignal(int )
+  {
+    THE_TO_STOP = 1;
+  }
+
+  //! Connected client.
+  struct ClientConnection
+  {
+    int         Socket = -1;
+    std::string Input;  //!< incomplete request line
+    std::string Output; //!< pending response
+    bool        IsEof = false; //!< client has shut down its sending side
+  };
+
+  //! Return TRUE if failed socket operation should be retried later.
+  static bool isRetryError(int theErr)
+  {
+    return theErr == EAGAIN || theErr == EWOULDBLOCK || theErr == EINTR;
+  }
+#endif
+}
+
+bool ProbeServer::IsSupported()
+{
+#if !defined(_WIN32) && !defined(__EMSCRIPTEN__)
+  return true;
+#else
+  return false;
+#endif
+}
+
+void ProbeServer::Stop()
+{
+  THE_TO_STOP = 1;
+}
+
+ProbeServer::~ProbeServer()
+{
+  // release contexts before platform sessions
+  for (LiveContext& aCtx : myContexts)
+    aCtx.Context.reset();
+  myContexts.clear();
+}
+
+int ProbeServer::AddProbe(const std::shared_ptr<RendererProbe>& theProbe)
+{
+  int aNbCreated = 0;
+  RendererReport aPlatformInfo;
+  for (BaseGlContext::ContextBits aBits : theProbe->ProbeOptions().Profiles)
+  {
+    std::shared_ptr<BaseGlContext> aCtx = theProbe->CreateContext(aBits);
+    if (aCtx.get() == nullptr)
+      continue;
+
+    LiveContext aLive;
+    aLive.Selector = toLowerCase(aCtx->PlatformName()) + ":" + BaseGlContext::ProfileName(aBits);
+    aLive.Probe = theProbe;
+    aLive.Context = aCtx;
+    aCtx->MakeCurrent();
+    if (aNbCreated == 0)
+      theProbe->CollectPlatformInfo(*aCtx, aPlatformInfo);
+    aLive.PlatformInfo = aPlatformInfo;
+    theProbe->CollectContextInfo(*aCtx, aLive.Report);
+    for (const std::string& anExt : aLive.Report.Extensions)
+      aLive.Extensions.Add(anExt.c_str(), anExt.length());
+    for (const RendererReport::Property& aProp : aLive.PlatformInfo.PlatformInfo)
+    {
+      for (const std::string& anExt : aProp.List)
+        aLive.Extensions.Add(anExt.c_str(), anExt.length());
+    }
+    myContexts.push_back(aLive);
+    ++aNbCreated;
+  }
+  return aNbCreated;
+}
+
+ProbeServer::LiveContext* ProbeServer::findContext(const std::string& theSelector)
+{
+  if (theSelector.empty())
+    return !myContexts.empty() ? &myContexts.front() : nullptr;
+
+  const std::string aSelector = toLowerCase(theSelector);
+  for (LiveContext& aCtx : myContexts)
+  {
+    if (aCtx.Selector == aSelector)
+      return &aCtx;
+  }
+  return nullptr;
+}
+
+std::string ProbeServer::Query(const std::string& theRequest)
+{
+  std::istringstream aStream(theRequest);
+  std::string aCmd, anArg, aSelector;
+  aStream >> aCmd;
+  aCmd = toLowerCase(aCmd);
+  const bool hasArg = aCmd == "limit" || aCmd == "extension";
+  if (hasArg && !(aStream >> anArg))
+    return "ERR missing argument";
+
+  aStream >> aSelector;
+  if (aCmd == "ping")
+  {
+    return "OK pong";
+  }
+  else if (aCmd == "profiles")
+  {
+    std::string aResult = "OK";
+    for (const LiveContext& aCtx : myContexts)
+      aResult += " " + aCtx.Selector;
+    return aResult;
+  }
+
+  LiveContext* aCtx = findContext(aSelector);
+  if (aCmd != "vendor" && aCmd != "renderer" && aCmd != "version"
+   && aCmd != "limit" && aCmd != "extension" && aCmd != "gpumemory")
+  {
+    return "ERR unknown command '" + aCmd + "'";
+  }
+  else if (aCtx == nullptr)
+  {
+    return "ERR unknown context '" + aSelector + "'";
+  }
+
+  const RendererReport& aReport = aCtx->Report;
+  if (aCmd == "vendor")
+  {
+    return "OK " + aReport.Vendor;
+  }
+  else if (aCmd == "renderer")
+  {
+    return "OK " + aReport.Renderer;
+  }
+  else if (aCmd == "version")
+  {
+    return "OK " + aReport.Version;
+  }
+  else if (aCmd == "limit")
+  {
+    for (const RendererReport::Limit& aLimit : aReport.Limits)
+    {
+      if (aLimit.Name != anArg)
+        continue;
+
+      std::string aResult = "OK";
+      for (int aValIter = 0; aValIter < aLimit.NbVals; ++aValIter)
+        aResult += " " + std::to_string(aLimit.Values[aValIter]);
+      return aResult;
+    }
+    return "ERR unknown limit '" + anArg + "'";
+  }
+  else if (aCmd == "extension")
+  {
+    return aCtx->Extensions.Has(anArg) ? "OK 1" : "OK 0";
+  }
+
+  // GPU memory is the only live query
+  if (!aCtx->Context->MakeCurrent())
+    return "ERR unable to make context current";
+
+  RendererReport aMemReport;
+  aCtx->Context->CollectGpuMemoryInfo(aMemReport);
+  std::string aResult = "OK";
+  for (const RendererReport::GpuMemory& aMem : aMemReport.GpuMemoryInfo)
+    aResult += " " + aMem.Key + "=" + std::to_string(aMem.MiB);
+  return aResult;
+}
+
+bool ProbeServer::Serve(const std::string& thePath)
+{
+#if !defined(_WIN32) && !defined(__EMSCRIPTEN__)
+  sockaddr_un anAddr;
+  memset(&anAddr, 0, sizeof(anAddr));
+  anAddr.sun_family = AF_UNIX;
+  if (thePath.empty() || thePath.size() >= sizeof(anAddr.sun_path))
+  {
+    std::cerr << "Error: invalid socket path '" << thePath << "'\n";
+    return false;
+  }
+  memcpy(anAddr.sun_path, thePath.c_str(), thePath.size());
+
+  // remove stale socket left by terminated daemon
+  struct stat aStat;
+  if (lstat(thePath.c_str(), &aStat) == 0 && S_ISSOCK(aStat.st_mode))
+    unlink(thePath.c_str());
+
+  const int aListenSock = socket(AF_UNIX, SOCK_STREAM, 0);
+  if (aListenSock == -1
+   || bind(aListenSock, (const sockaddr*)&anAddr, sizeof(anAddr)) != 0
+   || listen(aListenSock, 16) != 0)
+  {
+    std::cerr << "Error: unable to listen on socket '" << thePath << "': " << strerror(errno) << "\n";
+    if (aListenSock != -1)
+      close(aListenSock);
+    return false;
+  }
+
+  THE_TO_STOP = 0;
+  signal(SIGPIPE, SIG_IGN);
+  signal(SIGINT,  onStopSignal);
+  signal(SIGTERM, onStopSignal);
+
+  // serve all clients from this thread, as GL contexts are bound to it
+  std::vector<ClientConnection> aClients;
+  std::vector<pollfd> aPollFds;
+  while (!THE_TO_STOP)
+  {
+    aPollFds.clear();
+    pollfd aListenFd = { aListenSock, POLLIN, 0 };
+    aPollFds.push_back(aListenFd);
+    for (const ClientConnection& aClient : aClients)
+    {
+      // stop reading requests until pending responses are sent, so that a client
+      // pipelining requests without reading responses cannot grow output buffer without bound
+      const bool toRead = !aClient.IsEof && aClient.Output.empty();
+      const short anEvents = short((toRead ? POLLIN : 0) | (aClient.Output.empty() ? 0 : POLLOUT));
+      pollfd aClientFd = { aClient.Socket, anEvents, 0 };
+      aPollFds.push_back(aClientFd);
+    }
+
+    if (poll(aPollFds.data(), (nfds_t)aPollFds.size(), -1) < 0)
+    {
+      if (errno == EINTR)
+        continue;
+      break;
+    }
+
+    for (size_t aClientIter = 0; aClientIter < aClients.size(); ++aClientIter)
+    {
+      ClientConnection& aClient = aClients[aClientIter];
+      const short anEvents = aPollFds[aClientIter + 1].revents;
+      bool toClose = (anEvents & (POLLERR | POLLNVAL)) != 0;
+      if (!toClose && !aClient.IsEof && aClient.Output.empty() && (anEvents & (POLLIN | POLLHUP)) != 0)
+      {
+        char aBuffer[1024];
+        const ssize_t aNbRead = read(aClient.Socket, aBuffer, sizeof(aBuffer));
+        if (aNbRead == 0)
+        {
+          // half-closed connection - flush pending responses before closing
+          aClient.IsEof = true;
+        }
+        else if (aNbRead < 0)
+        {
+          toClose = !isRetryError(errno);
+        }
+        else
+        {
+          aClient.Input.append(aBuffer, (size_t)aNbRead);
+          for (size_t anEol = aClient.Input.find('\n'); anEol != std::string::npos; anEol = aClient.Input.find('\n'))
+          {
+            std::string aRequest = aClient.Input.substr(0, anEol);
+            aClient.Input.erase(0, anEol + 1);
+            if (!aRequest.empty() && aRequest.back() == '\r')
+              aRequest.pop_back();
+            aClient.Output += Query(aRequest) + "\n";
+          }
+          if (aClient.Input.size() > THE_MAX_REQUEST)
+            toClose = true;
+        }
+      }
+      if (!toClose && !aClient.Output.empty())
+      {
+        // non-blocking socket - send as much as possible and wait for POLLOUT for the rest
+        const ssize_t aNbSent = send(aClient.Socket, aClient.Output.data(), aClient.Output.size(), 0);
+        if (aNbSent < 0)
+          toClose = !isRetryError(errno);
+        else
+          aClient.Output.erase(0, (size_t)aNbSent);
+      }
+      if (aClient.IsEof && aClient.Output.empty())
+        toClose = true;
+      if (toClose)
+      {
+        close(aClient.Socket);
+        aClient.Socket = -1;
+      }
+    }
+    aClients.erase(std::remove_if(aClients.begin(), aClients.end(),
+                                  [](const ClientConnection& theClient) { return theClient.Socket == -1; }),
+                   aClients.end());
+
+    if ((aPollFds[0].revents & POLLIN) != 0)
+    {
+      const int aClientSock = accept(aListenSock, NULL, NULL);
+      if (aClientSock != -1)
+      {
+        // slow client should not stall serving loop
+        fcntl(aClientSock, F_SETFL, fcntl(aClientSock, F_GETFL, 0) | O_NONBLOCK);
+        ClientConnection aClient;
+        aClient.Socket = aClientSock;
+        aClients.push_back(aClient);
+      }
+    }
+  }
+
+  for (const ClientConnection& aClient : aClients)
+    close(aClient.Socket);
+  close(aListenSock);
+  unlink(thePath.c_str());
+  return true;
+#else
+  std::cerr << "Error: serving over UNIX socket is not supported on this platform\n";
+  (void)thePath;
+  return false;
+#endif
+}
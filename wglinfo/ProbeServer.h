@@ -0,0 +1,85 @@
+// Copyright © Kirill Gavrilov, 2026
+//
+// This code is licensed under MIT license (see LICENSE.txt for details).
+
+#ifndef PROBESERVER_HEADER
+#define PROBESERVER_HEADER
+
+#include "RendererProbe.h"
+
+#include <memory>
+#include <string>
+#include <vector>
+
+//! Resident daemon keeping one initialized context per platform/profile
+//! and answering capability queries over a local UNIX socket.
+//!
+//! Protocol is line-based: each request line produces a single response line
+//! "OK <value>" or "ERR <message>". Context selector is "<platform>:<profile>"
+//! (like "egl-surfaceless:core"); the first live context is used when omitted.
+//!   ping                         - check daemon is alive
+//!   profiles                     - list selectors of live contexts
+//!   vendor|renderer|version [S]  - renderer strings
+//!   limit <GL_NAME> [S]          - renderer limit value(s)
+//!   extension <NAME> [S]         - 1 if renderer or platform extension is supported, 0 otherwise
+//!   gpumemory [S]                - live GPU memory info as "key=MiB" pairs
+class ProbeServer
+{
+public:
+
+  //! Return TRUE if serving over UNIX socket is supported on this platform.
+  static bool IsSupported();
+
+  //! Request the serving loop to stop; could be called from signal handler.
+  static void Stop();
+
+public:
+
+  //! Empty constructor.
+  ProbeServer() {}
+
+  //! Destructor.
+  ~ProbeServer();
+
+  //! Create live contexts for all profiles of the probe and collect their static info.
+  //! @return number of created contexts
+  int AddProbe(const std::shared_ptr<RendererProbe>& theProbe);
+
+  //! Return number of live contexts.
+  size_t NbContexts() const { return myContexts.size(); }
+
+  //! Answer a single request line.
+  std::string Query(const std::string& theRequest);
+
+  //! Listen on UNIX socket and serve queries until Stop() or SIGINT/SIGTERM.
+  //! @return FALSE if socket cannot be created
+  bool Serve(const std::string& thePath);
+
+private:
+
+  //! Live context with collected static info.
+  struct LiveContext
+  {
+    std::string                    Selector;     //!< context selector "<platform>:<profile>"
+    std::shared_ptr<RendererProbe> Probe;        //!< probe owning platform session
+    std::shared_ptr<BaseGlContext> Context;      //!< live context
+    RendererReport                 PlatformInfo; //!< platform info
+    RendererReport                 Report;       //!< renderer info, extensions and limits
+    ExtensionSet                   Extensions;   //!< renderer and platform extensions indexed for lookups
+  };
+
+  //! Find live context by selector; first context for empty selector.
+  LiveContext* findContext(const std::string& theSelector);
+
+private:
+
+  ProbeServer(const ProbeServer& ) = delete;
+  ProbeServer& operator=(const ProbeServer& ) = delete;
+
+private:
+
+  std::vector<LiveContext> myContexts;
+
+};
+
+#endif // PROBESERVER_HEADER
@@ -0,0 +1,206 @@
+// Copyright © Kirill Gavrilov, 2026
+//
+// This code is licensed under MIT license (see LICENSE.txt for details).
+
+#include "ProbeTimings.h"
+
+#include "JsonWriter.h"
+
+#ifdef _WIN32
+  #include <windows.h>
+#else
+  #include <time.h>
+  #include <unistd.h>
+#endif
+
+#include <atomic>
+#include <ctime>
+#include <fstream>
+#include <iomanip>
+
+std::vector<ProbeTimings::Phase> ProbeTimings::myPhases;
+std::mutex ProbeTimings::myMutex;
+thread_local std::string ProbeTimings::myProbe;
+thread_local int ProbeTimings::myDepth = 0;
+bool ProbeTimings::myIsEnabled = false;
+
+//! Origin of trace timestamps.
+static const std::chrono::steady_clock::time_point THE_TIME_ORIGIN = std::chrono::steady_clock::now();
+
+double ProbeTimings::ThreadCpuTimeMs()
+{
+#if defined(_WIN32)
+  FILETIME aCreateTime, anExitTime, aKernelTime, aUserTime;
+  if (GetThreadTimes(GetCurrentThread(), &aCreateTime, &anExitTime, &aKernelTime, &aUserTime))
+  {
+    const unsigned long long aKernel = ((unsigned long long)aKernelTime.dwHighDateTime << 32) | aKernelTime.dwLowDateTime;
+    const unsigned long long aUser   = ((unsigned long long)aUserTime.dwHighDateTime   << 32) | aUserTime.dwLowDateTime;
+    return double(aKernel + aUser) * 0.0001; // 100-nanosecond intervals
+  }
+  return 0.0;
+#elif defined(CLOCK_THREAD_CPUTIME_ID) && !defined(__EMSCRIPTEN__)
+  timespec aTime = {};
+  if (clock_gettime(CLOCK_THREAD_CPUTIME_ID, &aTime) == 0)
+    return double(aTime.tv_sec) * 1000.0 + double(aTime.tv_nsec) * 0.000001;
+  return 0.0;
+#else
+  return double(std::clock()) * 1000.0 / double(CLOCKS_PER_SEC);
+#endif
+}
+
+int ProbeTimings::threadIndex()
+{
+  static std::atomic<int> THE_NB_THREADS(0);
+  static thread_local int THE_THREAD_INDEX = THE_NB_THREADS++;
+  return THE_THREAD_INDEX;
+}
+
+void ProbeTimings::Sentry::start()
+{
+  myIsActive = true;
+
+  Phase aPhase;
+  aPhase.Probe = myProbe;
+  aPhase.Name  = myName != nullptr ? myName : myProbe;
+  if (myVerMajor >= 0)
+    aPhase.Name += std::string(" ") + std::to_string(myVerMajor) + "." + std::to_string(myVerMinor);
+  aPhase.Cat    = myCat;
+  aPhase.Depth  = myDepth++;
+  aPhase.Thread = threadIndex();
+  {
+    std::lock_guard<std::mutex> aLock(myMutex);
+    myIndex = myPhases.size();
+    myPhases.push_back(aPhase);
+  }
+
+  myCpuStart  = ThreadCpuTimeMs();
+  myWallStart = std::chrono::steady_clock::now();
+}
+
+void ProbeTimings::Sentry::stop()
+{
+  const std::chrono::steady_clock::time_point aWallEnd = std::chrono::steady_clock::now();
+  const double aCpuEnd = ThreadCpuTimeMs();
+  myIsActive = false;
+  --myDepth;
+
+  std::lock_guard<std::mutex> aLock(myMutex);
+  Phase& aPhase = myPhases[myIndex];
+  aPhase.StartUs = std::chrono::duration<double, std::micro>(myWallStart - THE_TIME_ORIGIN).count();
+  aPhase.WallMs  = std::chrono::duration<double, std::milli>(aWallEnd - myWallStart).count();
+  aPhase.CpuMs   = aCpuEnd - myCpuStart;
+}
+
+void ProbeTimings::Sentry::setName(const std::string& theName)
+{
+  std::lock_guard<std::mutex> aLock(myMutex);
+  myPhases[myIndex].Name = theName;
+}
+
+void ProbeTimings::PrintTable(std::ostream& theStream)
+{
+  // group phases per probe preserving the order of first appearance;
+  // platform and profile spans are not printed - they are useful only within trace
+  std::vector<std::string> aProbes;
+  for (const Phase& aPhase : myPhases)
+  {
+    if (aPhase.Cat == Category_Platform || aPhase.Cat == Category_Profile)
+      continue;
+
+    bool isFound = false;
+    for (const std::string& aProbe : aProbes)
+    {
+      if (aProbe == aPhase.Probe)
+      {
+        isFound = true;
+        break;
+      }
+    }
+    if (!isFound)
+      aProbes.push_back(aPhase.Probe);
+  }
+
+  const std::ios_base::fmtflags anOldFlags = theStream.flags();
+  const std::streamsize anOldPrec = theStream.precision();
+  theStream << std::fixed << std::setprecision(3);
+  for (const std::string& aProbe : aProbes)
+  {
+    int aMinDepth = -1;
+    for (const Phase& aPhase : myPhases)
+    {
+      if (aPhase.Probe == aProbe
+       && aPhase.Cat != Category_Platform && aPhase.Cat != Category_Profile
+       && (aMinDepth < 0 || aPhase.Depth < aMinDepth))
+      {
+        aMinDepth = aPhase.Depth;
+      }
+    }
+
+    theStream << "\n" << (aProbe.empty() ? std::string("[wglinfo]") : aProbe) << " timings:\n"
+              << "  " << std::left << std::setw(44) << "phase" << std::right
+              << std::setw(12) << "wall, ms" << std::setw(12) << "cpu, ms" << "\n";
+    for (const Phase& aPhase : myPhases)
+    {
+      if (aPhase.Probe != aProbe
+       || aPhase.Cat == Category_Platform || aPhase.Cat == Category_Profile)
+      {
+        continue;
+      }
+
+      const std::string aName = std::string(size_t(aPhase.Depth - aMinDepth) * 2, ' ') + aPhase.Name;
+      theStream << "  " << std::left << std::setw(44) << aName << std::right
+                << std::setw(12) << aPhase.WallMs << std::setw(12) << aPhase.CpuMs << "\n";
+    }
+  }
+  theStream.flags(anOldFlags);
+  theStream.precision(anOldPrec);
+}
+
+void ProbeTimings::WriteChromeTrace(std::ostream& theStream)
+{
+  static const char* THE_CATEGORIES[] = { "phase", "stage", "profile", "platform" };
+#ifdef _WIN32
+  const unsigned long aPid = GetCurrentProcessId();
+#else
+  const long aPid = (long)getpid();
+#endif
+
+  const std::ios_base::fmtflags anOldFlags = theStream.flags();
+  const std::streamsize anOldPrec = theStream.precision();
+  theStream << std::fixed << std::setprecision(3);
+  theStream << "{\"displayTimeUnit\":\"ms\",\"traceEvents\":[\n"
+            << "{\"name\":\"process_name\",\"ph\":\"M\",\"pid\":" << aPid << ",\"tid\":0,\"args\":{\"name\":\"wglinfo\"}}";
+  for (const Phase& aPhase : myPhases)
+  {
+    theStream << ",\n{\"name\":";
+    JsonWriter::WriteString(theStream, aPhase.Name.c_str());
+    theStream << ",\"cat\":\"" << THE_CATEGORIES[aPhase.Cat] << "\""
+              << ",\"ph\":\"X\",\"pid\":" << aPid << ",\"tid\":" << aPhase.Thread
+              << ",\"ts\":" << aPhase.StartUs << ",\"dur\":" << (aPhase.WallMs * 1000.0)
+              << ",\"args\":{\"probe\":";
+    JsonWriter::WriteString(theStream, aPhase.Probe.c_str());
+    theStream << ",\"cpu_ms\":" << aPhase.CpuMs << "}}";
+  }
+  theStream << "\n]}\n";
+  theStream.flags(anOldFlags);
+  theStream.precision(anOldPrec);
+}
+
+bool ProbeTimings::WriteChromeTrace(const std::string& thePath)
+{
+  std::ofstream aFile(thePath.c_str(), std::ios::out | std::ios::binary);
+  if (!aFile.is_open())
+  {
+    std::cerr << "Error: unable to create trace file '" << thePath << "'\n";
+    return false;
+  }
+
+  WriteChromeTrace(aFile);
+  aFile.flush();
+  if (!aFile.good())
+  {
+    std::cerr << "Error: unable to write trace file '" << thePath << "'\n";
+    return false;
+  }
+  return true;
+}
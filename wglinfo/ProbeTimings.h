@@ -0,0 +1,149 @@
+// Copyright © Kirill Gavrilov, 2026
+//
+// This code is licensed under MIT license (see LICENSE.txt for details).
+
+#ifndef PROBETIMINGS_HEADER
+#define PROBETIMINGS_HEADER
+
+#include <chrono>
+#include <iostream>
+#include <mutex>
+#include <string>
+#include <vector>
+
+//! Collector of wall and CPU time spent within probe phases
+//! (context creation steps, print stages, etc.).
+//! Collected spans could be printed as a table or written as Chrome trace-event JSON.
+//! Collection is disabled by default - Sentry does nothing in this case.
+//! Phases could be collected from several threads; probe label and nesting level are tracked per thread.
+class ProbeTimings
+{
+public:
+
+  //! Span category.
+  enum Category
+  {
+    Category_Phase,    //!< driver call or context creation step
+    Category_Stage,    //!< print stage
+    Category_Profile,  //!< single profile probe
+    Category_Platform, //!< all probes of the platform
+  };
+
+  //! Measured phase.
+  struct Phase
+  {
+    std::string Probe;     //!< probe label, like "[EGL-x11] OpenGL (core profile)"
+    std::string Name;      //!< phase name
+    Category    Cat = Category_Phase; //!< span category
+    int         Depth = 0; //!< nesting level
+    int         Thread = 0;   //!< thread index
+    double      StartUs = 0.0; //!< start time in microseconds since process start
+    double      WallMs = 0.0; //!< elapsed wall time in milliseconds
+    double      CpuMs  = 0.0; //!< CPU time of calling thread in milliseconds
+  };
+
+  //! Auxiliary sentry measuring the scope.
+  class Sentry
+  {
+  public:
+    //! Start measuring phase with specified name (NULL means the current probe label).
+    Sentry(const char* theName, Category theCat = Category_Phase) : myName(theName), myCat(theCat)
+    {
+      if (myIsEnabled)
+        start();
+    }
+
+    //! Start measuring phase with specified name and GL version suffix (like "eglCreateContext 4.5").
+    Sentry(const char* theName, int theVerMajor, int theVerMinor) : myName(theName), myVerMajor(theVerMajor), myVerMinor(theVerMinor)
+    {
+      if (myIsEnabled)
+        start();
+    }
+
+    //! Stop measuring.
+    ~Sentry() { Stop(); }
+
+    //! Stop measuring and record the phase.
+    void Stop()
+    {
+      if (myIsActive)
+        stop();
+    }
+
+    //! Rename already started phase (for names known only after start).
+    void SetName(const std::string& theName)
+    {
+      if (myIsActive)
+        setName(theName);
+    }
+
+  private:
+    Sentry(const Sentry& ) = delete;
+    Sentry& operator=(const Sentry& ) = delete;
+
+    void start();
+    void stop();
+    void setName(const std::string& theName);
+
+  private:
+    const char* myName;
+    Category myCat = Category_Phase;
+    int    myVerMajor = -1;
+    int    myVerMinor = -1;
+    bool   myIsActive = false;
+    size_t myIndex = 0;
+    std::chrono::steady_clock::time_point myWallStart;
+    double myCpuStart = 0.0;
+  };
+
+public:
+
+  //! Return TRUE if collection is enabled.
+  static bool IsEnabled() { return myIsEnabled; }
+
+  //! Enable/disable collection.
+  static void SetEnabled(bool theToEnable) { myIsEnabled = theToEnable; }
+
+  //! Set label of the current probe within the calling thread, which will be assigned to following phases.
+  static void SetProbe(const std::string& theLabel) { myProbe = theLabel; }
+
+  //! Return collected phases.
+  static const std::vector<Phase>& Phases() { return myPhases; }
+
+  //! Remove phases collected after the first specified number of phases;
+  //! should be called when no phase is being measured.
+  static void Truncate(size_t theNbPhases)
+  {
+    std::lock_guard<std::mutex> aLock(myMutex);
+    if (theNbPhases < myPhases.size())
+      myPhases.resize(theNbPhases);
+  }
+
+  //! Print collected phases and stages as a table per probe.
+  static void PrintTable(std::ostream& theStream);
+
+  //! Write collected spans in Chrome trace-event JSON format (chrome://tracing, Perfetto UI).
+  static void WriteChromeTrace(std::ostream& theStream);
+
+  //! Write collected spans in Chrome trace-event JSON format into the file.
+  static bool WriteChromeTrace(const std::string& thePath);
+
+  //! Return CPU time of the calling thread in milliseconds.
+  static double ThreadCpuTimeMs();
+
+private:
+
+  //! Return index of the calling thread.
+  static int threadIndex();
+
+private:
+
+  static std::vector<Phase> myPhases;
+  static std::mutex myMutex;
+  static thread_local std::string myProbe;
+  static thread_local int myDepth;
+  static bool myIsEnabled;
+
+};
+
+#endif // PROBETIMINGS_HEADER
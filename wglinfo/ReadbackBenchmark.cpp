@@ -0,0 +1,258 @@
+// Copyright © Kirill Gavrilov, 2026
+//
+// This code is licensed under MIT license (see LICENSE.txt for details).
+
+#include "ReadbackBenchmark.h"
+
+#include <cstring>
+
+#define GL_MAX_TEXTURE_SIZE          0x0D33
+#define GL_TEXTURE_2D                0x0DE1
+#define GL_TEXTURE_MIN_FILTER        0x2801
+#define GL_NEAREST                   0x2600
+#define GL_RGBA                      0x1908
+#define GL_RGBA8                     0x8058
+#define GL_UNSIGNED_BYTE             0x1401
+#define GL_COLOR_BUFFER_BIT          0x00004000
+#define GL_FRAMEBUFFER               0x8D40
+#define GL_COLOR_ATTACHMENT0         0x8CE0
+#define GL_FRAMEBUFFER_COMPLETE      0x8CD5
+
+#define GL_PIXEL_PACK_BUFFER         0x88EB
+#define GL_STREAM_READ               0x88E1
+#define GL_MAP_READ_BIT              0x0001
+#define GL_SYNC_GPU_COMMANDS_COMPLETE 0x9117
+#define GL_SYNC_FLUSH_COMMANDS_BIT   0x00000001
+#define GL_TIMEOUT_EXPIRED           0x911B
+#define GL_WAIT_FAILED               0x911D
+
+namespace
+{
+  //! Default resolutions.
+  static const int THE_RESOLUTIONS[][2] = { { 1280, 720 }, { 1920, 1080 }, { 3840, 2160 } };
+
+  //! Sizes of PBO rings.
+  static const int THE_RING_SIZES[] = { 2, 4 };
+
+  //! Fence wait timeout in nanoseconds.
+  static const uint64_t THE_FENCE_TIMEOUT_NS = 1000000000;
+}
+
+bool ReadbackBenchmark::init(std::string& theReason)
+{
+  const GlFunctions& aGl = gl();
+  if (aGl.glGenFramebuffers == nullptr
+   || aGl.glReadPixels == nullptr
+   || (!isGles() && !isGlGreaterEqual(3, 0) && !hasExtension("GL_ARB_framebuffer_object")))
+  {
+    theReason = "framebuffer objects are unsupported";
+    return false;
+  }
+
+  // fences are core since OpenGL 3.2 and OpenGL ES 3.0
+  const bool hasRing = (isGles() ? isGlGreaterEqual(3, 0) : (isGlGreaterEqual(3, 2) || hasExtension("GL_ARB_sync")))
+                    && aGl.glFenceSync != nullptr
+                    && aGl.glClientWaitSync != nullptr
+                    && aGl.glGenBuffers != nullptr
+                    && aGl.glMapBufferRange != nullptr;
+  const bool hasDsa = !isGles()
+                   && (isGlGreaterEqual(4, 5) || hasExtension("GL_ARB_get_texture_sub_image"))
+                   && aGl.glGetTextureSubImage != nullptr;
+
+  std::vector<std::pair<int, int>> aResolutions = myResolutions;
+  if (aResolutions.empty())
+  {
+    for (const int* aRes : THE_RESOLUTIONS)
+      aResolutions.push_back(std::make_pair(aRes[0], aRes[1]));
+  }
+
+  int aMaxSize = 0;
+  myCtx->GlGetIntegerv(GL_MAX_TEXTURE_SIZE, &aMaxSize);
+  myReadCases.clear();
+  for (const std::pair<int, int>& aRes : aResolutions)
+  {
+    if (aRes.first > aMaxSize || aRes.second > aMaxSize)
+      continue;
+
+    const std::string aResName = std::to_string(aRes.first) + "x" + std::to_string(aRes.second);
+    ReadCase aReadCase;
+    aReadCase.Width  = aRes.first;
+    aReadCase.Height = aRes.second;
+
+    Case aCase;
+    aCase.NbBytes = double(aRes.first) * double(aRes.second) * 4.0;
+
+    aReadCase.ReadPath = Path_ReadPixels;
+    aCase.Name = "readpixels " + aResName;
+    myReadCases.push_back(aReadCase);
+    myCases.push_back(aCase);
+    if (hasRing)
+    {
+      for (int aRingSize : THE_RING_SIZES)
+      {
+        aReadCase.ReadPath = Path_PboRing;
+        aReadCase.RingSize = aRingSize;
+        aCase.Name = "pbo-ring" + std::to_string(aRingSize) + " " + aResName;
+        myReadCases.push_back(aReadCase);
+        myCases.push_back(aCase);
+      }
+    }
+    if (hasDsa)
+    {
+      aReadCase.ReadPath = Path_Dsa;
+      aReadCase.RingSize = 0;
+      aCase.Name = "dsa " + aResName;
+      myReadCases.push_back(aReadCase);
+      myCases.push_back(aCase);
+    }
+  }
+  return true;
+}
+
+bool ReadbackBenchmark::SetupCase(size_t theCase)
+{
+  const GlFunctions& aGl = gl();
+  const ReadCase& aReadCase = myReadCases[theCase];
+  const size_t aNbBytes = size_t(aReadCase.Width) * size_t(aReadCase.Height) * 4;
+  myData.resize(aNbBytes);
+  myFrame = 0;
+  myIterError.clear();
+
+  // OpenGL ES 2.0 doesn't accept sized internal formats
+  const int anInternalFormat = isGles() && !isGlGreaterEqual(3, 0) ? GL_RGBA : GL_RGBA8;
+  aGl.glGenTextures(1, &myTexture);
+  aGl.glBindTexture(GL_TEXTURE_2D, myTexture);
+  aGl.glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_NEAREST);
+  aGl.glTexImage2D(GL_TEXTURE_2D, 0, anInternalFormat, aReadCase.Width, aReadCase.Height, 0, GL_RGBA, GL_UNSIGNED_BYTE, nullptr);
+  aGl.glBindTexture(GL_TEXTURE_2D, 0);
+
+  aGl.glGenFramebuffers(1, &myFbo);
+  aGl.glBindFramebuffer(GL_FRAMEBUFFER, myFbo);
+  aGl.glFramebufferTexture2D(GL_FRAMEBUFFER, GL_COLOR_ATTACHMENT0, GL_TEXTURE_2D, myTexture, 0);
+  if (aGl.glCheckFramebufferStatus(GL_FRAMEBUFFER) != GL_FRAMEBUFFER_COMPLETE)
+    return false;
+
+  aGl.glViewport(0, 0, aReadCase.Width, aReadCase.Height);
+  if (aReadCase.ReadPath == Path_PboRing)
+  {
+    myPbos.resize(aReadCase.RingSize, 0);
+    myFences.assign(aReadCase.RingSize, nullptr);
+    mySubmitTimes.resize(aReadCase.RingSize);
+    aGl.glGenBuffers(aReadCase.RingSize, myPbos.data());
+    for (unsigned int aPbo : myPbos)
+    {
+      aGl.glBindBuffer(GL_PIXEL_PACK_BUFFER, aPbo);
+      aGl.glBufferData(GL_PIXEL_PACK_BUFFER, (ptrdiff_t )aNbBytes, nullptr, GL_STREAM_READ);
+    }
+    aGl.glBindBuffer(GL_PIXEL_PACK_BUFFER, 0);
+  }
+  return myCtx->GlGetError() == 0;
+}
+
+void ReadbackBenchmark::render()
+{
+  const GlFunctions& aGl = gl();
+  const float aColor = float(myFrame % 16) / 15.0f;
+  aGl.glClearColor(aColor, 0.5f, 1.0f - aColor, 1.0f);
+  aGl.glClear(GL_COLOR_BUFFER_BIT);
+}
+
+bool ReadbackBenchmark::consumeSlot(size_t theSlot)
+{
+  const GlFunctions& aGl = gl();
+  const unsigned int aRes = aGl.glClientWaitSync(myFences[theSlot], GL_SYNC_FLUSH_COMMANDS_BIT, THE_FENCE_TIMEOUT_NS);
+  aGl.glDeleteSync(myFences[theSlot]);
+  myFences[theSlot] = nullptr;
+  if (aRes == GL_TIMEOUT_EXPIRED || aRes == GL_WAIT_FAILED)
+  {
+    myIterError = aRes == GL_TIMEOUT_EXPIRED ? "fence wait has timed out" : "fence wait has failed";
+    return false;
+  }
+
+  aGl.glBindBuffer(GL_PIXEL_PACK_BUFFER, myPbos[theSlot]);
+  const void* aMapped = aGl.glMapBufferRange(GL_PIXEL_PACK_BUFFER, 0, (ptrdiff_t )myData.size(), GL_MAP_READ_BIT);
+  if (aMapped != nullptr)
+  {
+    memcpy(myData.data(), aMapped, myData.size());
+    aGl.glUnmapBuffer(GL_PIXEL_PACK_BUFFER);
+  }
+  aGl.glBindBuffer(GL_PIXEL_PACK_BUFFER, 0);
+  if (aMapped == nullptr)
+  {
+    myIterError = "glMapBufferRange() has failed";
+    return false;
+  }
+  myLastLatencyMs = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - mySubmitTimes[theSlot]).count();
+  return true;
+}
+
+void ReadbackBenchmark::Iterate(size_t theCase)
+{
+  const GlFunctions& aGl = gl();
+  const ReadCase& aReadCase = myReadCases[theCase];
+  const std::chrono::steady_clock::time_point aStart = std::chrono::steady_clock::now();
+  myLastLatencyMs = -1.0;
+  render();
+  switch (aReadCase.ReadPath)
+  {
+    case Path_ReadPixels:
+    {
+      aGl.glReadPixels(0, 0, aReadCase.Width, aReadCase.Height, GL_RGBA, GL_UNSIGNED_BYTE, myData.data());
+      myLastLatencyMs = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - aStart).count();
+      break;
+    }
+    case Path_PboRing:
+    {
+      // write into the current slot and consume the oldest one, written RingSize-1 frames ago
+      const size_t aSlot = myFrame % myPbos.size();
+      if (myFences[aSlot] != nullptr
+       && !consumeSlot(aSlot))
+      {
+        break;
+      }
+
+      aGl.glBindBuffer(GL_PIXEL_PACK_BUFFER, myPbos[aSlot]);
+      aGl.glReadPixels(0, 0, aReadCase.Width, aReadCase.Height, GL_RGBA, GL_UNSIGNED_BYTE, nullptr);
+      aGl.glBindBuffer(GL_PIXEL_PACK_BUFFER, 0);
+      myFences[aSlot] = aGl.glFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0);
+      mySubmitTimes[aSlot] = aStart;
+      aGl.glFlush();
+
+      const size_t anOldest = (myFrame + 1) % myPbos.size();
+      if (myFences[anOldest] != nullptr)
+        consumeSlot(anOldest);
+      break;
+    }
+    case Path_Dsa:
+    {
+      aGl.glGetTextureSubImage(myTexture, 0, 0, 0, 0, aReadCase.Width, aReadCase.Height, 1,
+                               GL_RGBA, GL_UNSIGNED_BYTE, (int )myData.size(), myData.data());
+      myLastLatencyMs = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - aStart).count();
+      break;
+    }
+  }
+  ++myFrame;
+}
+
+void ReadbackBenchmark::ReleaseCase(size_t )
+{
+  const GlFunctions& aGl = gl();
+  for (void*& aFence : myFences)
+  {
+    if (aFence != nullptr)
+      aGl.glDeleteSync(aFence);
+    aFence = nullptr;
+  }
+  if (!myPbos.empty())
+    aGl.glDeleteBuffers((int )myPbos.size(), myPbos.data());
+  aGl.glBindFramebuffer(GL_FRAMEBUFFER, 0);
+  aGl.glDeleteFramebuffers(1, &myFbo);
+  aGl.glDeleteTextures(1, &myTexture);
+  myPbos.clear();
+  myFences.clear();
+  mySubmitTimes.clear();
+  myFbo = 0;
+  myTexture = 0;
+  myData.clear();
+  myData.shrink_to_fit();
+}
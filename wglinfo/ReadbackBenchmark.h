@@ -0,0 +1,84 @@
+// Copyright © Kirill Gavrilov, 2026
+//
+// This code is licensed under MIT license (see LICENSE.txt for details).
+
+#ifndef READBACKBENCHMARK_HEADER
+#define READBACKBENCHMARK_HEADER
+
+#include "GlBenchmark.h"
+
+#include <chrono>
+
+//! Benchmark of reading back rendered frames ("readback").
+//! Each iteration renders (clears) RGBA8 framebuffer object and reads it back into client memory via:
+//! - "readpixels" - synchronous glReadPixels() to client memory;
+//! - "pbo-ringN"  - glReadPixels() into a ring of N pixel pack buffers guarded by fences,
+//!                  mapping the oldest buffer once its fence has been signaled (pipelined);
+//! - "dsa"        - synchronous glGetTextureSubImage() of color attachment (OpenGL 4.5).
+//! Frame latency is measured from the start of rendering till the frame appears in client memory.
+class ReadbackBenchmark : public GlBenchmark
+{
+public:
+
+  //! Readback path.
+  enum Path
+  {
+    Path_ReadPixels, //!< synchronous glReadPixels()
+    Path_PboRing,    //!< ring of PBOs with fences
+    Path_Dsa,        //!< synchronous glGetTextureSubImage()
+  };
+
+public:
+
+  //! Empty constructor.
+  ReadbackBenchmark() {}
+
+  //! Return TRUE for PBO ring cases.
+  virtual bool IsPipelined(size_t theCase) const override { return myReadCases[theCase].ReadPath == Path_PboRing; }
+
+  //! Create framebuffer and PBO ring of the case.
+  virtual bool SetupCase(size_t theCase) override;
+
+  //! Render and read back a frame.
+  virtual void Iterate(size_t theCase) override;
+
+  //! Release framebuffer and PBO ring.
+  virtual void ReleaseCase(size_t theCase) override;
+
+protected:
+
+  //! Define cases for resolutions and paths supported by context.
+  virtual bool init(std::string& theReason) override;
+
+private:
+
+  //! Internal case definition.
+  struct ReadCase
+  {
+    Path ReadPath = Path_ReadPixels;
+    int  Width = 0;
+    int  Height = 0;
+    int  RingSize = 0;
+  };
+
+  //! Render a frame.
+  void render();
+
+  //! Wait for the fence of ring slot and copy its content into client memory.
+  //! @return FALSE on failed fence wait or buffer mapping, with error stored in myIterError
+  bool consumeSlot(size_t theSlot);
+
+private:
+
+  std::vector<ReadCase>      myReadCases;        //!< definition of each case
+  std::vector<unsigned char> myData;             //!< client memory receiving frames
+  std::vector<unsigned int>  myPbos;             //!< ring of pixel pack buffers
+  std::vector<void*>         myFences;           //!< fences of ring slots, NULL for free slot
+  std::vector<std::chrono::steady_clock::time_point> mySubmitTimes; //!< frame start time of ring slots
+  unsigned int               myFbo = 0;          //!< framebuffer object
+  unsigned int               myTexture = 0;      //!< color attachment
+  size_t                     myFrame = 0;        //!< frame counter
+
+};
+
+#endif // READBACKBENCHMARK_HEADER
@@ -0,0 +1,397 @@
+// Copyright © Kirill Gavrilov, 2026
+//
+// This code is licensed under MIT license (see LICENSE.txt for details).
+
+#include "RendererProbe.h"
+
+#include "EglGlContext.h"
+#include "NativeGlContext.h"
+#include "ProbeIsolator.h"
+#include "ProbeTimings.h"
+
+#include <algorithm>
+
+namespace
+{
+  //! Listener collecting results into RendererProbe::Result.
+  class ResultListener : public RendererProbe::Listener
+  {
+  public:
+    ResultListener(RendererProbe::Result& theResult) : myResult(theResult) {}
+
+    virtual void OnPlatform(const RendererReport& theInfo) override { myResult.PlatformInfo = theInfo; }
+    virtual void OnProfile(const RendererReport& theReport) override { myResult.Profiles.push_back(theReport); }
+    virtual void OnVisuals(const RendererReport& theReport) override { myResult.Visuals = theReport; }
+    virtual void OnError(const std::string& theMessage) override { myResult.Errors.push_back(theMessage); }
+
+  private:
+    RendererProbe::Result& myResult;
+  };
+}
+
+RendererProbe::Options::Options()
+{
+  Profiles.push_back(BaseGlContext::ContextBits_NONE);
+  Profiles.push_back(BaseGlContext::ContextBits_CoreProfile);
+  Profiles.push_back(BaseGlContext::ContextBits_GLES);
+  Profiles.push_back(BaseGlContext::ContextBits_SoftProfile);
+#if defined(__APPLE__)
+  Profiles.push_back(BaseGlContext::ContextBits(BaseGlContext::ContextBits_CoreProfile | BaseGlContext::ContextBits_SoftProfile));
+#endif
+}
+
+bool RendererProbe::QueryEglDevices(std::vector<void*>& theDevices)
+{
+  EglSurfacelessContext aQueryCtx("wglinfo");
+  return aQueryCtx.QueryDevices(theDevices);
+}
+
+RendererProbe::RendererProbe(Platform thePlatform, const Options& theOptions)
+: myOptions(theOptions),
+  myPlatform(thePlatform)
+{
+  if (myPlatform == Platform_Egl && myOptions.EglWindow.get() == nullptr)
+  {
+    // probably XDG_SESSION_TYPE=wayland should be respected here
+    // instead of trying to connect to Wayland server via WlWindow::HasServer()...
+  #ifdef HAVE_WAYLAND
+    if (WlWindow::HasServer())
+      myOptions.EglWindow.reset(new WlWindow(""));
+    else
+      myOptions.EglWindow.reset(new XwWindow(""));
+  #else
+    myOptions.EglWindow.reset(new NativeWindow(""));
+  #endif
+  }
+
+  myOptions.Profiles.erase(std::remove_if(myOptions.Profiles.begin(), myOptions.Profiles.end(),
+                                          [thePlatform](BaseGlContext::ContextBits theBits) { return !IsProfileSupported(thePlatform, theBits); }),
+                           myOptions.Profiles.end());
+
+  std::unique_ptr<BaseGlContext> aCtx(newContext("wglinfo"));
+  myPlatformName = aCtx->PlatformName();
+}
+
+BaseGlContext* RendererProbe::newContext(const std::string& theTitle) const
+{
+  switch (myPlatform)
+  {
+    case Platform_Native:
+    {
+      return new NativeGlContext(theTitle);
+    }
+    case Platform_Egl:
+    {
+      EglGlContext* aCtx = new EglGlContext(myOptions.EglWindow->EmptyCopy(theTitle));
+      aCtx->SetOffscreen(myOptions.IsOffscreen);
+      return aCtx;
+    }
+    case Platform_EglSurfaceless:
+    {
+      EglSurfacelessContext* aCtx = new EglSurfacelessContext(theTitle);
+      if (myOptions.EglDevice != nullptr)
+        aCtx->SetEglDevice(myOptions.EglDevice, myOptions.EglDeviceIndex);
+      return aCtx;
+    }
+  }
+  return nullptr;
+}
+
+RendererProbe::Result RendererProbe::Probe()
+{
+  Result aResult;
+  ResultListener aListener(aResult);
+  const std::vector<BaseGlContext::ContextBits> aDone = ProbeProfiles(aListener);
+  if (!aDone.empty()
+   && (myOptions.Sections & RendererReport::Section_Visuals) != 0)
+  {
+    ProbeVisuals(aDone[0], aListener);
+  }
+  return aResult;
+}
+
+std::vector<BaseGlContext::ContextBits> RendererProbe::ProbeProfiles(Listener& theListener)
+{
+  if (myOptions.IsIsolated)
+    return probeProfilesIsolated(theListener);
+
+  ProbeTimings::Sentry aPlatformTimer("ProbeProfiles", ProbeTimings::Category_Platform);
+  aPlatformTimer.SetName(std::string("ProbeProfiles [") + myPlatformName + "]");
+  std::vector<BaseGlContext::ContextBits> aSucceeded;
+  for (size_t anOptIter = 0; anOptIter < myOptions.Profiles.size(); ++anOptIter)
+  {
+    const BaseGlContext::ContextBits anOpt = myOptions.Profiles[anOptIter];
+    if (!theListener.ToProbe(anOpt))
+      continue;
+
+    std::unique_ptr<BaseGlContext> aCtx(newContext("wglinfo"));
+    if (ProbeTimings::IsEnabled())
+      ProbeTimings::SetProbe(BaseGlContext::ProbeLabel(aCtx->PlatformName(), anOpt));
+    ProbeTimings::Sentry aProfileTimer(nullptr, ProbeTimings::Category_Profile);
+    aCtx->SetSession(mySession);
+    {
+      ProbeTimings::Sentry aTimer("CreateGlContext");
+      const bool isCreated = aCtx->CreateGlContext(anOpt);
+      mySession = aCtx->Session(); // keep driver initialized for the following profiles
+      if (!isCreated)
+        continue;
+    }
+
+    aSucceeded.push_back(anOpt);
+    if (aSucceeded.size() == 1)
+    {
+      // report platform once
+      RendererReport aPlatformInfo;
+      CollectPlatformInfo(*aCtx, aPlatformInfo);
+      theListener.OnPlatform(aPlatformInfo);
+    }
+
+    RendererReport aReport;
+    CollectContextInfo(*aCtx, aReport);
+    theListener.OnProfile(aReport);
+
+    if (aSucceeded.size() == 1
+     && (myOptions.Sections & RendererReport::Section_Visuals) != 0
+     && myPlatform != Platform_Egl)
+    {
+      // keep context to collect visuals without creating another one;
+      // not applicable to EGL window surface, as EGL contexts share a single native window
+      // and another surface cannot be created on it for the following profiles
+      myVisualsCtx = std::move(aCtx);
+    }
+    else
+    {
+      ProbeTimings::Sentry aTimer("Release");
+      aCtx->Release();
+    }
+
+    if (myOptions.IsFirstOnly)
+      break;
+  }
+
+  if (!aSucceeded.empty())
+    theListener.OnPlatformEnd();
+  return aSucceeded;
+}
+
+std::vector<BaseGlContext::ContextBits> RendererProbe::probeProfilesIsolated(Listener& theListener)
+{
+  // each probe initializes its own display within a child process
+  std::vector<BaseGlContext::ContextBits> anOptions;
+  for (BaseGlContext::ContextBits anOpt : myOptions.Profiles)
+  {
+    if (theListener.ToProbe(anOpt))
+      anOptions.push_back(anOpt);
+  }
+
+  std::vector<ProbeIsolator::Probe> aProbes;
+  for (size_t anOptIter = 0; anOptIter < anOptions.size(); ++anOptIter)
+  {
+    const BaseGlContext::ContextBits anOpt = anOptions[anOptIter];
+    aProbes.push_back([this, anOpt](ProbeResult& theResult)
+    {
+      theResult.Bits = anOpt;
+      std::unique_ptr<BaseGlContext> aCtx(newContext("wglinfo"));
+      if (!aCtx->CreateGlContext(anOpt))
+      {
+        theResult.State = ProbeResult::Status_Failed;
+        return;
+      }
+
+      RendererReport aPlatformInfo, aReport;
+      CollectPlatformInfo(*aCtx, aPlatformInfo);
+      CollectContextInfo(*aCtx, aReport);
+      aCtx->Release();
+      aPlatformInfo.Serialize(theResult.Platform);
+      aReport.Serialize(theResult.Report);
+      theResult.State = ProbeResult::Status_Ok;
+    });
+  }
+
+  ProbeTimings::Sentry aPlatformTimer("ProbeProfiles", ProbeTimings::Category_Platform);
+  aPlatformTimer.SetName(std::string("ProbeProfiles [") + myPlatformName + "]");
+
+  ProbeIsolator anIsolator(myOptions.TimeoutMs);
+  std::vector<ProbeResult> aResults;
+  if (myOptions.IsFirstOnly && myOptions.NbJobs <= 1)
+  {
+    for (size_t aProbeIter = 0; aProbeIter < aProbes.size(); ++aProbeIter)
+    {
+      aResults.push_back(anIsolator.Run(aProbes[aProbeIter]));
+      if (aResults.back().State == ProbeResult::Status_Ok)
+        break;
+    }
+  }
+  else
+  {
+    // results are returned in original order, so that output is the same as for serial run
+    aResults = anIsolator.RunAll(aProbes, myOptions.NbJobs);
+    for (size_t aResIter = 0; myOptions.IsFirstOnly && aResIter < aResults.size(); ++aResIter)
+    {
+      if (aResults[aResIter].State == ProbeResult::Status_Ok)
+      {
+        aResults.resize(aResIter + 1);
+        break;
+      }
+    }
+  }
+
+  std::vector<BaseGlContext::ContextBits> aSucceeded;
+  for (size_t aResIter = 0; aResIter < aResults.size(); ++aResIter)
+  {
+    ProbeResult& aResult = aResults[aResIter];
+    aResult.Bits = anOptions[aResIter];
+    const std::string aLabel = BaseGlContext::ProbeLabel(myPlatformName.c_str(), anOptions[aResIter]);
+    if (!theListener.ToProbe(anOptions[aResIter])
+     || !checkProbeResult(aLabel, aResult, theListener))
+      continue;
+
+    RendererReport aPlatformInfo, aReport;
+    if (!aReport.Deserialize(aResult.Report)
+     || (aSucceeded.empty() && !aPlatformInfo.Deserialize(aResult.Platform)))
+    {
+      theListener.OnError(aLabel + " probe returned malformed report");
+      continue;
+    }
+
+    aSucceeded.push_back(anOptions[aResIter]);
+    if (aSucceeded.size() == 1)
+      theListener.OnPlatform(aPlatformInfo); // report platform once
+    theListener.OnProfile(aReport);
+  }
+
+  if (!aSucceeded.empty())
+    theListener.OnPlatformEnd();
+  return aSucceeded;
+}
+
+bool RendererProbe::ProbeVisuals(BaseGlContext::ContextBits theBits, Listener& theListener)
+{
+  std::unique_ptr<BaseGlContext> aDummy = std::move(myVisualsCtx);
+  const bool isReused = aDummy.get() != nullptr && aDummy->Bits() == theBits && !myOptions.IsIsolated;
+  if (!isReused)
+    aDummy.reset(newContext("wglinfo_dummy"));
+
+  const std::string aLabel = std::string("[") + aDummy->PlatformName() + "] visuals";
+  if (ProbeTimings::IsEnabled())
+    ProbeTimings::SetProbe(aLabel);
+  ProbeTimings::Sentry aVisualsTimer(nullptr, ProbeTimings::Category_Profile);
+  aDummy->SetSession(mySession);
+
+  RendererReport aReport;
+  const auto aCollector = [&](RendererReport& theReport)
+  {
+    if (isReused ? aDummy->MakeCurrent() : aDummy->CreateGlContext(theBits))
+    {
+      ProbeTimings::Sentry aTimer("CollectVisuals", ProbeTimings::Category_Stage);
+      aDummy->InitReport(theReport);
+      aDummy->CollectVisuals(theReport, myOptions.IsVerbose);
+    }
+  };
+  if (!collectIsolated(aLabel, aCollector, aReport, theListener))
+    return false;
+
+  theListener.OnVisuals(aReport);
+  return true;
+}
+
+std::shared_ptr<BaseGlContext> RendererProbe::CreateContext(BaseGlContext::ContextBits theBits)
+{
+  std::shared_ptr<BaseGlContext> aCtx(newContext("wglinfo"));
+  aCtx->SetSession(mySession);
+  const bool isCreated = aCtx->CreateGlContext(theBits);
+  mySession = aCtx->Session();
+  if (!isCreated)
+    return std::shared_ptr<BaseGlContext>();
+  return aCtx;
+}
+
+void RendererProbe::CollectContextInfo(BaseGlContext& theCtx, RendererReport& theReport) const
+{
+  theCtx.InitReport(theReport);
+  if ((myOptions.Sections & RendererReport::Section_Renderer) != 0)
+  {
+    ProbeTimings::Sentry aTimer("CollectRendererInfo", ProbeTimings::Category_Stage);
+    theCtx.CollectRendererInfo(theReport);
+  }
+
+  if ((myOptions.Sections & RendererReport::Section_GpuMemory) != 0)
+  {
+    ProbeTimings::Sentry aTimer("CollectGpuMemoryInfo", ProbeTimings::Category_Stage);
+    theCtx.CollectGpuMemoryInfo(theReport);
+  }
+
+  if ((myOptions.Sections & RendererReport::Section_Extensions) != 0)
+  {
+    ProbeTimings::Sentry aTimer("CollectExtensions", ProbeTimings::Category_Stage);
+    theCtx.CollectExtensions(theReport);
+  }
+
+  if ((myOptions.Sections & RendererReport::Section_Limits) != 0)
+  {
+    ProbeTimings::Sentry aTimer("CollectLimits", ProbeTimings::Category_Stage);
+    theCtx.CollectLimits(theReport);
+  }
+}
+
+void RendererProbe::CollectPlatformInfo(BaseGlContext& theCtx, RendererReport& theReport) const
+{
+  theCtx.InitReport(theReport);
+  if ((myOptions.Sections & RendererReport::Section_Platform) != 0)
+  {
+    ProbeTimings::Sentry aTimer("CollectPlatformInfo", ProbeTimings::Category_Stage);
+    theCtx.CollectPlatformInfo(theReport, (myOptions.Sections & RendererReport::Section_Extensions) != 0);
+  }
+}
+
+bool RendererProbe::checkProbeResult(const std::string& theLabel, const ProbeResult& theResult, Listener& theListener)
+{
+  switch (theResult.State)
+  {
+    case ProbeResult::Status_Ok:
+    {
+      return true;
+    }
+    case ProbeResult::Status_Failed:
+    {
+      break; // context creation failures are silent, as in-process
+    }
+    case ProbeResult::Status_Timeout:
+    case ProbeResult::Status_Crashed:
+    {
+      theListener.OnError(theLabel + " probe " + ProbeResult::StatusName(theResult.State) + ": " + theResult.Details);
+      break;
+    }
+  }
+  return false;
+}
+
+bool RendererProbe::collectIsolated(const std::string& theLabel,
+                                    const std::function<void(RendererReport& )>& theCollector,
+                                    RendererReport& theReport,
+                                    Listener& theListener)
+{
+  if (!myOptions.IsIsolated)
+  {
+    theCollector(theReport);
+    return true;
+  }
+
+  ProbeIsolator anIsolator(myOptions.TimeoutMs);
+  const ProbeResult aResult = anIsolator.Run([&theCollector](ProbeResult& theResult)
+  {
+    RendererReport aReport;
+    theCollector(aReport);
+    aReport.Serialize(theResult.Report);
+    theResult.State = ProbeResult::Status_Ok;
+  });
+  if (!checkProbeResult(theLabel, aResult, theListener))
+    return false;
+
+  if (!theReport.Deserialize(aResult.Report))
+  {
+    theListener.OnError(theLabel + " probe returned malformed report");
+    return false;
+  }
+  return true;
+}
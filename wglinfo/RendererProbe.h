@@ -0,0 +1,176 @@
+// Copyright © Kirill Gavrilov, 2026
+//
+// This code is licensed under MIT license (see LICENSE.txt for details).
+
+#ifndef RENDERERPROBE_HEADER
+#define RENDERERPROBE_HEADER
+
+#include "BaseGlContext.h"
+
+#include <functional>
+#include <memory>
+#include <string>
+#include <vector>
+
+struct ProbeResult;
+
+//! Public entry point of libwglinfo - probes OpenGL / OpenGL ES profiles of a platform
+//! and returns structured RendererReport results instead of printing them.
+//!
+//! Probe keeps platform session (display connection, loaded driver) alive between calls,
+//! so that long-lived applications may create a context once via CreateContext()
+//! and re-query it with CollectContextInfo() without paying driver initialization cost.
+class RendererProbe
+{
+public:
+
+  //! Probed platform.
+  enum Platform
+  {
+    Platform_Native,         //!< WGL, GLX, CGL or WebGL
+    Platform_Egl,            //!< EGL with a native window
+    Platform_EglSurfaceless, //!< headless EGL (EGL_MESA_platform_surfaceless or EGL_EXT_platform_device)
+  };
+
+  //! Probing options.
+  struct Options
+  {
+    std::vector<BaseGlContext::ContextBits> Profiles; //!< profiles to probe in specified order
+    int   Sections    = RendererReport::Section_ALL;  //!< RendererReport::Section mask of information to collect
+    bool  IsVerbose   = false;   //!< collect verbose description of visuals
+    bool  IsFirstOnly = false;   //!< stop on first successfully created profile
+    bool  IsIsolated  = false;   //!< run each probe in a child process
+    int   TimeoutMs   = 10000;   //!< deadline for isolated probe
+    int   NbJobs      = 1;       //!< number of isolated probes running concurrently
+    std::shared_ptr<BaseWindow> EglWindow; //!< window defining EGL window system; NULL means default one
+    void* EglDevice   = nullptr; //!< EGLDeviceEXT for headless platform; NULL means surfaceless platform
+    int   EglDeviceIndex = 0;    //!< index of EGL device used within platform name
+    bool  IsOffscreen = false;   //!< create EGL contexts without window surface, so that several could be kept alive
+
+    //! Default options probing main profiles.
+    Options();
+  };
+
+  //! Receiver of probing results, called in the order of probing.
+  class Listener
+  {
+  public:
+    virtual ~Listener() {}
+
+    //! Platform info collected from the first successfully created profile.
+    virtual void OnPlatform(const RendererReport& ) {}
+
+    //! Successfully created profile.
+    virtual void OnProfile(const RendererReport& ) {}
+
+    //! All profiles of the platform have been probed; called only after OnPlatform().
+    virtual void OnPlatformEnd() {}
+
+    //! Visuals of the platform.
+    virtual void OnVisuals(const RendererReport& ) {}
+
+    //! Isolated probe has timed out, crashed or returned malformed data.
+    virtual void OnError(const std::string& ) {}
+
+    //! Return FALSE to skip profile, e.g. when it cannot influence the result anymore.
+    virtual bool ToProbe(BaseGlContext::ContextBits ) const { return true; }
+  };
+
+  //! Complete results of probing a platform.
+  struct Result
+  {
+    RendererReport              PlatformInfo; //!< platform info, empty if no profile has been created
+    std::vector<RendererReport> Profiles;     //!< successfully created profiles
+    RendererReport              Visuals;      //!< visuals of the platform
+    std::vector<std::string>    Errors;       //!< failures of isolated probes
+  };
+
+public:
+
+  //! Enumerate EGL devices (EGL_EXT_device_enumeration).
+  static bool QueryEglDevices(std::vector<void*>& theDevices);
+
+  //! Return FALSE for profile which cannot be created on the platform at all.
+  //! Software profile requires a private display initialized with modified process environment (LIBGL_ALWAYS_SOFTWARE),
+  //! while EGL surfaceless/device platforms return the same display for every call;
+  //! Mesa exposes software renderer as a dedicated EGL device instead.
+  static bool IsProfileSupported(Platform thePlatform, BaseGlContext::ContextBits theBits)
+  {
+    return thePlatform != Platform_EglSurfaceless
+        || (theBits & BaseGlContext::ContextBits_SoftProfile) == 0;
+  }
+
+public:
+
+  //! Main constructor.
+  RendererProbe(Platform thePlatform, const Options& theOptions = Options());
+
+  //! Destructor.
+  ~RendererProbe() { Release(); }
+
+  //! Return probing options.
+  const Options& ProbeOptions() const { return myOptions; }
+
+  //! Return platform name (EGL, WGL, GLX, CGL, etc.).
+  const std::string& PlatformName() const { return myPlatformName; }
+
+  //! Probe all profiles and visuals of the platform.
+  Result Probe();
+
+  //! Probe profiles specified by options.
+  //! @return list of successfully created profiles
+  std::vector<BaseGlContext::ContextBits> ProbeProfiles(Listener& theListener);
+
+  //! Collect visuals of the platform using a context of specified profile;
+  //! the first context created by ProbeProfiles() is reused when profile matches, otherwise a dummy one is created.
+  //! @return FALSE if visuals could not be collected
+  bool ProbeVisuals(BaseGlContext::ContextBits theBits, Listener& theListener);
+
+  //! Create a context sharing platform session with other probes;
+  //! context stays alive till released by caller and may be re-queried with CollectContextInfo().
+  //! @return NULL if context cannot be created
+  std::shared_ptr<BaseGlContext> CreateContext(BaseGlContext::ContextBits theBits);
+
+  //! Collect renderer info, GPU memory, extensions and limits of created context.
+  void CollectContextInfo(BaseGlContext& theCtx, RendererReport& theReport) const;
+
+  //! Collect platform info of created context.
+  void CollectPlatformInfo(BaseGlContext& theCtx, RendererReport& theReport) const;
+
+  //! Release platform session (terminate display connection).
+  void Release()
+  {
+    myVisualsCtx.reset();
+    mySession.reset();
+  }
+
+private:
+
+  //! Create a context object (without creating GL context) for probed platform.
+  BaseGlContext* newContext(const std::string& theTitle) const;
+
+  //! Probe profiles in child processes.
+  std::vector<BaseGlContext::ContextBits> probeProfilesIsolated(Listener& theListener);
+
+  //! Report failure of probe executed in child process.
+  //! @return TRUE if probe has succeeded
+  static bool checkProbeResult(const std::string& theLabel, const ProbeResult& theResult, Listener& theListener);
+
+  //! Execute collector in child process, if isolation is enabled.
+  //! @return FALSE if isolated collector has failed
+  bool collectIsolated(const std::string& theLabel,
+                       const std::function<void(RendererReport& )>& theCollector,
+                       RendererReport& theReport,
+                       Listener& theListener);
+
+private:
+
+  Options     myOptions;
+  Platform    myPlatform;
+  std::string myPlatformName;
+  std::shared_ptr<BaseGlContext::PlatformSession> mySession; //!< session shared by all probed profiles
+  std::unique_ptr<BaseGlContext> myVisualsCtx; //!< first probed context kept alive for collecting visuals
+
+};
+
+#endif // RENDERERPROBE_HEADER
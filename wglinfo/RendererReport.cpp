@@ -0,0 +1,315 @@
+// Copyright © Kirill Gavrilov, 2026
+//
+// This code is licensed under MIT license (see LICENSE.txt for details).
+
+#include "RendererReport.h"
+
+#include "BinaryData.h"
+
+#include <initializer_list>
+
+//! Serialized data signature and version.
+static const char THE_REPORT_MAGIC[4] = { 'W', 'G', 'R', '1' };
+
+//! Number of integer fields of serialized visual info.
+static const int THE_NB_VISUAL_INTS = 25;
+
+void RendererReport::AddPlatformProperty(const std::string& theKey, const char* theValue,
+                                         const std::string& theLabel)
+{
+  Property aProp;
+  aProp.Key    = theKey;
+  aProp.Label  = !theLabel.empty() ? theLabel : theKey;
+  aProp.Value  = theValue != nullptr ? theValue : "";
+  aProp.IsNull = theValue == nullptr;
+  PlatformInfo.push_back(aProp);
+}
+
+void RendererReport::AddPlatformExtensions(const std::string& theKey, const std::string& theLabel,
+                                           const char* theExtensions)
+{
+  Property aProp;
+  aProp.Key    = theKey;
+  aProp.Label  = theLabel;
+  aProp.IsList = true;
+  aProp.IsNull = theExtensions == nullptr;
+  SplitExtensions(theExtensions, aProp.List);
+  PlatformInfo.push_back(aProp);
+}
+
+void RendererReport::SplitExtensions(const char* theExtensions, std::vector<std::string>& theList)
+{
+  if (theExtensions == nullptr)
+    return;
+
+  const char* aStart = theExtensions;
+  for (const char* aCharIter = theExtensions;; ++aCharIter)
+  {
+    if (*aCharIter == ' ' || *aCharIter == '\0')
+    {
+      if (aCharIter != aStart)
+        theList.push_back(std::string(aStart, aCharIter));
+      if (*aCharIter == '\0')
+        break;
+      aStart = aCharIter + 1;
+    }
+  }
+}
+
+std::string RendererReport::JoinExtensions(const std::vector<std::string>& theList)
+{
+  std::string aStr;
+  for (const std::string& anExt : theList)
+  {
+    if (!aStr.empty())
+      aStr += ' ';
+    aStr += anExt;
+  }
+  return aStr;
+}
+
+namespace
+{
+  //! Append list of strings.
+  static void writeList(std::string& theData, const std::vector<std::string>& theList)
+  {
+    BinaryData::WriteUInt32(theData, (uint32_t)theList.size());
+    for (const std::string& anItem : theList)
+      BinaryData::WriteString(theData, anItem);
+  }
+
+  //! Read list of strings.
+  static bool readList(const std::string& theData, size_t& thePos, std::vector<std::string>& theList)
+  {
+    uint32_t aNbItems = 0;
+    if (!BinaryData::ReadUInt32(theData, thePos, aNbItems)
+     || aNbItems > theData.size() - thePos)
+    {
+      return false;
+    }
+
+    theList.resize(aNbItems);
+    for (std::string& anItem : theList)
+    {
+      if (!BinaryData::ReadString(theData, thePos, anItem))
+        return false;
+    }
+    return true;
+  }
+
+  //! Append boolean flag.
+  static void writeBool(std::string& theData, bool theVal)
+  {
+    BinaryData::WriteUInt32(theData, theVal ? 1 : 0);
+  }
+
+  //! Read boolean flag.
+  static bool readBool(const std::string& theData, size_t& thePos, bool& theVal)
+  {
+    uint32_t aVal = 0;
+    if (!BinaryData::ReadUInt32(theData, thePos, aVal))
+      return false;
+
+    theVal = aVal != 0;
+    return true;
+  }
+}
+
+void RendererReport::Serialize(std::string& theData) const
+{
+  theData.assign(THE_REPORT_MAGIC, sizeof(THE_REPORT_MAGIC));
+  BinaryData::WriteInt32(theData, Sections);
+  BinaryData::WriteString(theData, Platform);
+  BinaryData::WriteInt32(theData, ContextBits);
+
+  BinaryData::WriteUInt32(theData, (uint32_t)PlatformInfo.size());
+  for (const Property& aProp : PlatformInfo)
+  {
+    BinaryData::WriteString(theData, aProp.Key);
+    BinaryData::WriteString(theData, aProp.Label);
+    BinaryData::WriteString(theData, aProp.Value);
+    writeList(theData, aProp.List);
+    writeBool(theData, aProp.IsList);
+    writeBool(theData, aProp.IsNull);
+  }
+  BinaryData::WriteString(theData, PlatformPrefix);
+  BinaryData::WriteInt32(theData, PlatformLabelWidth);
+
+  BinaryData::WriteString(theData, Vendor);
+  BinaryData::WriteString(theData, Renderer);
+  BinaryData::WriteString(theData, Version);
+  BinaryData::WriteString(theData, ShadingLanguageVersion);
+  writeBool(theData, HasShadingLanguageVersion);
+
+  BinaryData::WriteUInt32(theData, (uint32_t)GpuMemoryInfo.size());
+  for (const GpuMemory& aMem : GpuMemoryInfo)
+  {
+    BinaryData::WriteString(theData, aMem.Key);
+    BinaryData::WriteString(theData, aMem.Label);
+    BinaryData::WriteInt32(theData, aMem.MiB);
+  }
+
+  writeList(theData, Extensions);
+
+  BinaryData::WriteUInt32(theData, (uint32_t)Limits.size());
+  for (const Limit& aLim : Limits)
+  {
+    BinaryData::WriteString(theData, aLim.Name);
+    BinaryData::WriteInt32(theData, aLim.NbVals);
+    BinaryData::WriteInt32(theData, aLim.Values[0]);
+    BinaryData::WriteInt32(theData, aLim.Values[1]);
+  }
+  writeList(theData, ShadingLanguageVersions);
+
+  BinaryData::WriteString(theData, VisualsTitle);
+  BinaryData::WriteUInt32(theData, (uint32_t)Visuals.size());
+  for (const VisualInfo& anInfo : Visuals)
+  {
+    const int anInts[THE_NB_VISUAL_INTS] =
+    {
+      anInfo.ConfigId, anInfo.ConfigCaveat, anInfo.BufferType, anInfo.SurfaceType,
+      anInfo.ColorDepth, anInfo.ColorBufferSize, anInfo.LuminanceSize,
+      anInfo.RedSize, anInfo.GreenSize, anInfo.BlueSize, anInfo.AlphaSize,
+      anInfo.DepthSize, anInfo.StencilSize, anInfo.SwapIntervalMin, anInfo.SwapIntervalMax,
+      anInfo.NbAuxBuffers, anInfo.AccumRedSize, anInfo.AccumGreenSize, anInfo.AccumBlueSize, anInfo.AccumAlphaSize,
+      anInfo.NbSampleBuffers, anInfo.NbSamples, anInfo.LayerLevel, anInfo.NbLayersUnderlay, anInfo.NbLayersOverlay
+    };
+    for (int aValue : anInts)
+      BinaryData::WriteInt32(theData, aValue);
+    writeBool(theData, anInfo.IsSoftware);
+    writeBool(theData, anInfo.IsColorFloat);
+    writeBool(theData, anInfo.IsStereoBuffer);
+    writeBool(theData, anInfo.IsSRgb);
+  }
+  writeList(theData, VisualDetails);
+  BinaryData::WriteInt32(theData, VisualsSeparator);
+  writeBool(theData, IsHexConfigId);
+  writeBool(theData, IsVerboseVisuals);
+}
+
+bool RendererReport::Deserialize(const std::string& theData)
+{
+  *this = RendererReport();
+  if (theData.size() < sizeof(THE_REPORT_MAGIC)
+   || theData.compare(0, sizeof(THE_REPORT_MAGIC), THE_REPORT_MAGIC, sizeof(THE_REPORT_MAGIC)) != 0)
+  {
+    return false;
+  }
+
+  size_t aPos = sizeof(THE_REPORT_MAGIC);
+  uint32_t aNbItems = 0;
+  if (!BinaryData::ReadInt32(theData, aPos, Sections)
+   || !BinaryData::ReadString(theData, aPos, Platform)
+   || !BinaryData::ReadInt32(theData, aPos, ContextBits)
+   || !BinaryData::ReadUInt32(theData, aPos, aNbItems)
+   || aNbItems > theData.size() - aPos)
+  {
+    return false;
+  }
+
+  PlatformInfo.resize(aNbItems);
+  for (Property& aProp : PlatformInfo)
+  {
+    if (!BinaryData::ReadString(theData, aPos, aProp.Key)
+     || !BinaryData::ReadString(theData, aPos, aProp.Label)
+     || !BinaryData::ReadString(theData, aPos, aProp.Value)
+     || !readList(theData, aPos, aProp.List)
+     || !readBool(theData, aPos, aProp.IsList)
+     || !readBool(theData, aPos, aProp.IsNull))
+    {
+      return false;
+    }
+  }
+
+  if (!BinaryData::ReadString(theData, aPos, PlatformPrefix)
+   || !BinaryData::ReadInt32(theData, aPos, PlatformLabelWidth)
+   || !BinaryData::ReadString(theData, aPos, Vendor)
+   || !BinaryData::ReadString(theData, aPos, Renderer)
+   || !BinaryData::ReadString(theData, aPos, Version)
+   || !BinaryData::ReadString(theData, aPos, ShadingLanguageVersion)
+   || !readBool(theData, aPos, HasShadingLanguageVersion)
+   || !BinaryData::ReadUInt32(theData, aPos, aNbItems)
+   || aNbItems > theData.size() - aPos)
+  {
+    return false;
+  }
+
+  GpuMemoryInfo.resize(aNbItems);
+  for (GpuMemory& aMem : GpuMemoryInfo)
+  {
+    if (!BinaryData::ReadString(theData, aPos, aMem.Key)
+     || !BinaryData::ReadString(theData, aPos, aMem.Label)
+     || !BinaryData::ReadInt32(theData, aPos, aMem.MiB))
+    {
+      return false;
+    }
+  }
+
+  if (!readList(theData, aPos, Extensions)
+   || !BinaryData::ReadUInt32(theData, aPos, aNbItems)
+   || aNbItems > theData.size() - aPos)
+  {
+    return false;
+  }
+
+  Limits.resize(aNbItems);
+  for (Limit& aLim : Limits)
+  {
+    if (!BinaryData::ReadString(theData, aPos, aLim.Name)
+     || !BinaryData::ReadInt32(theData, aPos, aLim.NbVals)
+     || !BinaryData::ReadInt32(theData, aPos, aLim.Values[0])
+     || !BinaryData::ReadInt32(theData, aPos, aLim.Values[1]))
+    {
+      return false;
+    }
+  }
+
+  if (!readList(theData, aPos, ShadingLanguageVersions)
+   || !BinaryData::ReadString(theData, aPos, VisualsTitle)
+   || !BinaryData::ReadUInt32(theData, aPos, aNbItems)
+   || aNbItems > theData.size() - aPos)
+  {
+    return false;
+  }
+
+  Visuals.resize(aNbItems);
+  for (VisualInfo& anInfo : Visuals)
+  {
+    int anInts[THE_NB_VISUAL_INTS] = {};
+    for (int& aValue : anInts)
+    {
+      if (!BinaryData::ReadInt32(theData, aPos, aValue))
+        return false;
+    }
+
+    const int* aValIter = anInts;
+    anInfo.ConfigId     = *aValIter++;
+    anInfo.ConfigCaveat = (VisualInfo::Caveat )*aValIter++;
+    anInfo.BufferType   = (VisualInfo::ColorBuffer )*aValIter++;
+    anInfo.SurfaceType  = (VisualInfo::Surface )*aValIter++;
+    for (int* aField : { &anInfo.ColorDepth, &anInfo.ColorBufferSize, &anInfo.LuminanceSize,
+                         &anInfo.RedSize, &anInfo.GreenSize, &anInfo.BlueSize, &anInfo.AlphaSize,
+                         &anInfo.DepthSize, &anInfo.StencilSize, &anInfo.SwapIntervalMin, &anInfo.SwapIntervalMax,
+                         &anInfo.NbAuxBuffers, &anInfo.AccumRedSize, &anInfo.AccumGreenSize, &anInfo.AccumBlueSize, &anInfo.AccumAlphaSize,
+                         &anInfo.NbSampleBuffers, &anInfo.NbSamples, &anInfo.LayerLevel, &anInfo.NbLayersUnderlay, &anInfo.NbLayersOverlay })
+    {
+      *aField = *aValIter++;
+    }
+    if (!readBool(theData, aPos, anInfo.IsSoftware)
+     || !readBool(theData, aPos, anInfo.IsColorFloat)
+     || !readBool(theData, aPos, anInfo.IsStereoBuffer)
+     || !readBool(theData, aPos, anInfo.IsSRgb))
+    {
+      return false;
+    }
+  }
+
+  if (!readList(theData, aPos, VisualDetails)
+   || !BinaryData::ReadInt32(theData, aPos, VisualsSeparator)
+   || !readBool(theData, aPos, IsHexConfigId)
+   || !readBool(theData, aPos, IsVerboseVisuals))
+  {
+    return false;
+  }
+  return aPos == theData.size();
+}
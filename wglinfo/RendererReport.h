@@ -0,0 +1,207 @@
+// Copyright © Kirill Gavrilov, 2026
+//
+// This code is licensed under MIT license (see LICENSE.txt for details).
+
+#ifndef RENDERERREPORT_HEADER
+#define RENDERERREPORT_HEADER
+
+#include <string>
+#include <vector>
+
+//! Information collected from a platform or GL context, independent from output format.
+//! Filled by BaseGlContext::Collect*() methods and rendered by ReportFormatter.
+//! Only sections flagged within Sections have been collected.
+struct RendererReport
+{
+  //! Report sections.
+  enum Section
+  {
+    Section_NONE       = 0x00,
+    Section_Platform   = 0x01,
+    Section_Renderer   = 0x02,
+    Section_GpuMemory  = 0x04,
+    Section_Extensions = 0x08,
+    Section_Limits     = 0x10,
+    Section_Visuals    = 0x20,
+    Section_ALL        = 0x3F,
+  };
+
+  //! Platform property - either a string value or a list of strings (extensions).
+  struct Property
+  {
+    std::string Key;    //!< property name in camel case (JSON key)
+    std::string Label;  //!< text label
+    std::string Value;  //!< string value
+    std::vector<std::string> List; //!< list value
+    bool IsList = false;
+    bool IsNull = false; //!< value is undefined
+  };
+
+  //! GPU memory counter.
+  struct GpuMemory
+  {
+    std::string Key;   //!< counter name in camel case (JSON key)
+    std::string Label; //!< text label
+    int         MiB = 0;
+  };
+
+  //! Integer limit or range limit.
+  struct Limit
+  {
+    std::string Name;
+    int NbVals = 1;
+    int Values[2] = { 0, 0 };
+  };
+
+  //! Visual info.
+  struct VisualInfo
+  {
+    int ConfigId = 0;
+
+    enum Caveat
+    {
+      Caveat_None = 0x00,
+      Caveat_Slow = 0x01,
+      Caveat_NonConformant = 0x02
+    };
+    Caveat ConfigCaveat = Caveat_None;
+    bool IsSoftware = false;
+
+    //int RenderbableType;
+
+    enum ColorBuffer
+    {
+      ColorBuffer_ColorIndex,
+      ColorBuffer_Luminance,
+      ColorBuffer_Rgba,
+    };
+    ColorBuffer BufferType = ColorBuffer_Rgba;
+    bool        IsColorFloat = false;
+
+    enum Surface
+    {
+      Surface_None    = 0x00,
+      Surface_Window  = 0x01,
+      Surface_Pixmap  = 0x02,
+      Surface_PBuffer = 0x04,
+      Surface_PBufferRemote = 0x08,
+    };
+    Surface SurfaceType = Surface_None;
+
+    int ColorDepth = 0;
+    int ColorBufferSize = 0;
+    int LuminanceSize = 0;
+    int RedSize = 0;
+    int GreenSize = 0;
+    int BlueSize = 0;
+    int AlphaSize = 0;
+    int DepthSize = 0;
+    int StencilSize = 0;
+
+    int  SwapIntervalMin = 0;
+    int  SwapIntervalMax = 0;
+    bool IsStereoBuffer = false;
+    bool IsSRgb = false;
+
+    int NbAuxBuffers = 0;
+    int AccumRedSize = 0;
+    int AccumGreenSize = 0;
+    int AccumBlueSize = 0;
+    int AccumAlphaSize = 0;
+
+    int NbSampleBuffers = 0;
+    int NbSamples = 0;
+
+    int LayerLevel = 0; // 0 indicates main layer
+    int NbLayersUnderlay = 0;
+    int NbLayersOverlay = 0;
+  };
+
+public:
+
+  int         Sections = Section_NONE; //!< collected sections
+  std::string Platform;                //!< platform name (EGL, WGL, GLX, CGL, etc.)
+  int         ContextBits = 0;         //!< BaseGlContext::ContextBits of the context
+
+  // platform info
+  std::vector<Property> PlatformInfo;
+  std::string PlatformPrefix;          //!< text prefix of platform properties; "[Platform] " if empty
+  int         PlatformLabelWidth = 0;  //!< text width of property label aligning values
+
+  // renderer info
+  std::string Vendor;
+  std::string Renderer;
+  std::string Version;
+  std::string ShadingLanguageVersion;
+  bool        HasShadingLanguageVersion = false;
+
+  std::vector<GpuMemory>   GpuMemoryInfo;
+  std::vector<std::string> Extensions;
+  std::vector<Limit>       Limits;
+  std::vector<std::string> ShadingLanguageVersions; //!< GL_SHADING_LANGUAGE_VERSION list
+
+  // visuals
+  std::string VisualsTitle;
+  std::vector<VisualInfo>  Visuals;
+  std::vector<std::string> VisualDetails;  //!< optional verbose text per visual
+  int  VisualsSeparator = -1;              //!< index of visual to put table separator before
+  bool IsHexConfigId    = true;            //!< print ConfigId in hex
+  bool IsVerboseVisuals = false;           //!< visuals collected in verbose mode
+
+public:
+
+  //! Return TRUE if section has been collected.
+  bool HasSection(Section theSection) const { return (Sections & theSection) != 0; }
+
+  //! Append platform property with string value (NULL is stored as undefined).
+  void AddPlatformProperty(const std::string& theKey, const char* theValue,
+                           const std::string& theLabel = std::string());
+
+  //! Append platform property with list of space-separated extensions (NULL is stored as undefined).
+  void AddPlatformExtensions(const std::string& theKey, const std::string& theLabel, const char* theExtensions);
+
+  //! Append GPU memory counter.
+  void AddGpuMemory(const std::string& theKey, const std::string& theLabel, int theMiB)
+  {
+    GpuMemory aMem;
+    aMem.Key = theKey;
+    aMem.Label = theLabel;
+    aMem.MiB = theMiB;
+    GpuMemoryInfo.push_back(aMem);
+  }
+
+  //! Append integer limit.
+  void AddLimit(const std::string& theName, int theVal)
+  {
+    Limit aLim;
+    aLim.Name = theName;
+    aLim.Values[0] = theVal;
+    Limits.push_back(aLim);
+  }
+
+  //! Append integer range limit.
+  void AddLimitRange(const std::string& theName, int theMin, int theMax)
+  {
+    Limit aLim;
+    aLim.Name = theName;
+    aLim.NbVals = 2;
+    aLim.Values[0] = theMin;
+    aLim.Values[1] = theMax;
+    Limits.push_back(aLim);
+  }
+
+  //! Split space-separated list of extensions.
+  static void SplitExtensions(const char* theExtensions, std::vector<std::string>& theList);
+
+  //! Join list of extensions into space-separated string.
+  static std::string JoinExtensions(const std::vector<std::string>& theList);
+
+  //! Serialize report into compact binary form.
+  void Serialize(std::string& theData) const;
+
+  //! Deserialize report; returns FALSE on malformed data.
+  bool Deserialize(const std::string& theData);
+
+};
+
+#endif // RENDERERREPORT_HEADER
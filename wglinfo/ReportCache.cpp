@@ -0,0 +1,369 @@
+// Copyright © Kirill Gavrilov, 2026
+//
+// This code is licensed under MIT license (see LICENSE.txt for details).
+
+#include "ReportCache.h"
+
+#include "BinaryData.h"
+
+#if !defined(_WIN32) && !defined(__EMSCRIPTEN__)
+  #include <cerrno>
+  #include <dirent.h>
+  #include <fcntl.h>
+  #include <sys/mman.h>
+  #include <sys/stat.h>
+  #include <unistd.h>
+#endif
+
+#include <algorithm>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <sstream>
+#include <vector>
+
+namespace
+{
+  //! Cache entry file magic.
+  static const char THE_CACHE_MAGIC[4] = {'W','G','C','1'};
+
+  //! Return value of environment variable or empty string.
+  static std::string getEnv(const char* theName)
+  {
+    const char* aVal = getenv(theName);
+    return aVal != NULL ? std::string(aVal) : std::string();
+  }
+
+  //! Return 64-bit FNV-1a hash of the string.
+  static uint64_t hashString(const std::string& theStr)
+  {
+    uint64_t aHash = 14695981039346656037ull;
+    for (size_t aCharIter = 0; aCharIter < theStr.size(); ++aCharIter)
+    {
+      aHash ^= (unsigned char)theStr[aCharIter];
+      aHash *= 1099511628211ull;
+    }
+    return aHash;
+  }
+
+  //! Read length-prefixed block from raw memory.
+  static bool readBlock(const char* theData, size_t theSize, size_t& thePos,
+                        const char*& theBlock, size_t& theBlockSize)
+  {
+    if (thePos + 4 > theSize)
+      return false;
+
+    uint32_t aLen = 0;
+    for (int aByteIter = 0; aByteIter < 4; ++aByteIter)
+      aLen |= uint32_t((unsigned char)theData[thePos + aByteIter]) << (aByteIter * 8);
+    thePos += 4;
+    if (thePos + aLen > theSize)
+      return false;
+
+    theBlock = theData + thePos;
+    theBlockSize = aLen;
+    thePos += aLen;
+    return true;
+  }
+
+#if !defined(_WIN32) && !defined(__EMSCRIPTEN__)
+  //! Append file identity (path, size, inode and modification time) to fingerprint.
+  static bool appendFileStat(std::string& theFp, const std::string& thePath)
+  {
+    struct stat aStat;
+    if (stat(thePath.c_str(), &aStat) != 0)
+      return false;
+
+    theFp += thePath + " " + std::to_string((long long)aStat.st_size)
+           + " " + std::to_string((unsigned long long)aStat.st_ino)
+           + " " + std::to_string((long long)aStat.st_mtime) + "\n";
+    return true;
+  }
+
+  //! Append content of small text file (like sysfs attribute) to fingerprint.
+  static void appendFileContent(std::string& theFp, const std::string& thePath)
+  {
+    std::ifstream aFile(thePath.c_str());
+    std::string aLine;
+    if (aFile.is_open() && std::getline(aFile, aLine))
+      theFp += thePath + " " + aLine + "\n";
+  }
+
+  //! Return sorted list of directory entries.
+  static std::vector<std::string> listDirectory(const std::string& thePath)
+  {
+    std::vector<std::string> aList;
+    DIR* aDir = opendir(thePath.c_str());
+    if (aDir == NULL)
+      return aList;
+
+    for (struct dirent* anEntry = readdir(aDir); anEntry != NULL; anEntry = readdir(aDir))
+    {
+      if (strcmp(anEntry->d_name, ".") != 0
+       && strcmp(anEntry->d_name, "..") != 0)
+      {
+        aList.push_back(anEntry->d_name);
+      }
+    }
+    closedir(aDir);
+    std::sort(aList.begin(), aList.end());
+    return aList;
+  }
+
+  //! Append unique path to the list.
+  static void appendPath(std::vector<std::string>& theList, const std::string& thePath)
+  {
+    if (!thePath.empty()
+     && std::find(theList.begin(), theList.end(), thePath) == theList.end())
+    {
+      theList.push_back(thePath);
+    }
+  }
+
+  //! Append unique existing directory to the list, resolving symbolic links (e.g. /lib -> /usr/lib).
+  static void appendDirectory(std::vector<std::string>& theList, const std::string& thePath)
+  {
+    char* aRealPath = realpath(thePath.c_str(), NULL);
+    if (aRealPath != NULL)
+    {
+      appendPath(theList, aRealPath);
+      free(aRealPath);
+    }
+  }
+
+  //! Split list of paths separated by ':'.
+  static void appendPathList(std::vector<std::string>& theList, const std::string& thePaths)
+  {
+    std::stringstream aStream(thePaths);
+    std::string aPath;
+    while (std::getline(aStream, aPath, ':'))
+      appendPath(theList, aPath);
+  }
+
+  //! Return library search directories in dynamic linker resolution order.
+  static std::vector<std::string> librarySearchPaths()
+  {
+    std::vector<std::string> aDirs, aLdPaths;
+    appendPathList(aLdPaths, getEnv("LD_LIBRARY_PATH"));
+    for (const std::string& aDir : aLdPaths)
+      appendDirectory(aDirs, aDir);
+    for (const std::string& aConf : listDirectory("/etc/ld.so.conf.d"))
+    {
+      std::ifstream aFile(("/etc/ld.so.conf.d/" + aConf).c_str());
+      std::string aLine;
+      while (std::getline(aFile, aLine))
+      {
+        if (!aLine.empty() && aLine[0] == '/')
+          appendDirectory(aDirs, aLine);
+      }
+    }
+
+    static const char* THE_DEFAULT_DIRS[] = { "/lib64", "/lib", "/usr/lib64", "/usr/lib", "/usr/local/lib" };
+    for (const char* aDir : THE_DEFAULT_DIRS)
+      appendDirectory(aDirs, aDir);
+    return aDirs;
+  }
+#endif
+}
+
+bool ReportCache::IsSupported()
+{
+#if !defined(_WIN32) && !defined(__EMSCRIPTEN__)
+  return true;
+#else
+  return false;
+#endif
+}
+
+std::string ReportCache::DefaultDirectory()
+{
+  const std::string aXdgCache = getEnv("XDG_CACHE_HOME");
+  if (!aXdgCache.empty())
+    return aXdgCache + "/wglinfo";
+
+  const std::string aHome = getEnv("HOME");
+  if (!aHome.empty())
+    return aHome + "/.cache/wglinfo";
+  return std::string();
+}
+
+std::string ReportCache::Fingerprint()
+{
+  std::string aFp;
+#if !defined(_WIN32) && !defined(__EMSCRIPTEN__)
+  // environment affecting driver selection
+  static const char* THE_ENV_VARS[] =
+  {
+    "__GLX_VENDOR_LIBRARY_NAME", "__EGL_VENDOR_LIBRARY_FILENAMES", "__EGL_VENDOR_LIBRARY_DIRS",
+    "__NV_PRIME_RENDER_OFFLOAD", "DRI_PRIME", "LIBGL_ALWAYS_SOFTWARE", "LIBGL_DRIVERS_PATH",
+    "GALLIUM_DRIVER", "MESA_LOADER_DRIVER_OVERRIDE", "MESA_GL_VERSION_OVERRIDE",
+    "MESA_GLSL_VERSION_OVERRIDE", "MESA_GLES_VERSION_OVERRIDE", "MESA_EXTENSION_OVERRIDE",
+    "EGL_PLATFORM", "LD_LIBRARY_PATH", "DISPLAY", "WAYLAND_DISPLAY"
+  };
+  for (const char* aVar : THE_ENV_VARS)
+    aFp += std::string(aVar) + "=" + getEnv(aVar) + "\n";
+
+  // dynamic linker cache changes on ldconfig
+  appendFileStat(aFp, "/etc/ld.so.cache");
+
+  // resolved dispatch and vendor libraries
+  static const char* THE_DSO_NAMES[] =
+  {
+    "libEGL.so.1", "libGL.so.1", "libGLX.so.0", "libGLdispatch.so.0", "libOpenGL.so.0", "libGLESv2.so.2",
+    "libEGL_mesa.so.0", "libGLX_mesa.so.0", "libgallium_dri.so",
+    "libEGL_nvidia.so.0", "libGLX_nvidia.so.0", "libnvidia-glcore.so"
+  };
+  const std::vector<std::string> aLibDirs = librarySearchPaths();
+  for (const char* aDsoName : THE_DSO_NAMES)
+  {
+    for (const std::string& aDir : aLibDirs)
+    {
+      if (appendFileStat(aFp, aDir + "/" + aDsoName))
+        break;
+    }
+  }
+#if defined(__APPLE__)
+  appendFileStat(aFp, "/System/Library/Frameworks/OpenGL.framework/OpenGL");
+#endif
+
+  // Mesa DRI drivers and GLVND vendor files
+  std::vector<std::string> aDriverDirs;
+  appendPathList(aDriverDirs, getEnv("LIBGL_DRIVERS_PATH"));
+  for (const std::string& aDir : aLibDirs)
+    appendPath(aDriverDirs, aDir + "/dri");
+  appendPath(aDriverDirs, "/usr/share/glvnd/egl_vendor.d");
+  appendPath(aDriverDirs, "/etc/glvnd/egl_vendor.d");
+  for (const std::string& aDir : aDriverDirs)
+  {
+    for (const std::string& aName : listDirectory(aDir))
+      appendFileStat(aFp, aDir + "/" + aName);
+  }
+
+  // DRM device nodes
+  for (const std::string& aNode : listDirectory("/dev/dri"))
+  {
+    struct stat aStat;
+    if (stat(("/dev/dri/" + aNode).c_str(), &aStat) == 0)
+      aFp += "/dev/dri/" + aNode + " " + std::to_string((unsigned long long)aStat.st_rdev) + "\n";
+
+    appendFileContent(aFp, "/sys/class/drm/" + aNode + "/device/vendor");
+    appendFileContent(aFp, "/sys/class/drm/" + aNode + "/device/device");
+  }
+#endif
+  return aFp;
+}
+
+std::string ReportCache::entryPath(const std::string& theKey) const
+{
+  char aName[64];
+  snprintf(aName, sizeof(aName), "report-%016llx.bin", (unsigned long long)hashString(theKey));
+  return myDir + "/" + aName;
+}
+
+bool ReportCache::Open(const std::string& theKey, const std::string& theFingerprint)
+{
+  Close();
+#if !defined(_WIN32) && !defined(__EMSCRIPTEN__)
+  if (myDir.empty())
+    return false;
+
+  const int aFile = open(entryPath(theKey).c_str(), O_RDONLY);
+  if (aFile == -1)
+    return false;
+
+  struct stat aStat;
+  if (fstat(aFile, &aStat) != 0
+   || aStat.st_size < (off_t)sizeof(THE_CACHE_MAGIC))
+  {
+    close(aFile);
+    return false;
+  }
+
+  void* aMapped = mmap(NULL, (size_t)aStat.st_size, PROT_READ, MAP_PRIVATE, aFile, 0);
+  close(aFile);
+  if (aMapped == MAP_FAILED)
+    return false;
+
+  myMapped = aMapped;
+  myMappedSize = (size_t)aStat.st_size;
+
+  const char* aData = (const char*)myMapped;
+  size_t aPos = sizeof(THE_CACHE_MAGIC);
+  const char* aFp = NULL;
+  const char* aKey = NULL;
+  size_t aFpSize = 0, aKeySize = 0;
+  if (memcmp(aData, THE_CACHE_MAGIC, sizeof(THE_CACHE_MAGIC)) != 0
+   || !readBlock(aData, myMappedSize, aPos, aFp, aFpSize)
+   || !readBlock(aData, myMappedSize, aPos, aKey, aKeySize)
+   || !readBlock(aData, myMappedSize, aPos, myData, mySize)
+   || aFpSize != theFingerprint.size()
+   || aKeySize != theKey.size()
+   || memcmp(aFp, theFingerprint.data(), aFpSize) != 0
+   || memcmp(aKey, theKey.data(), aKeySize) != 0)
+  {
+    Close();
+    return false;
+  }
+  return true;
+#else
+  (void)theKey;
+  (void)theFingerprint;
+  return false;
+#endif
+}
+
+void ReportCache::Close()
+{
+#if !defined(_WIN32) && !defined(__EMSCRIPTEN__)
+  if (myMapped != nullptr)
+    munmap(myMapped, myMappedSize);
+#endif
+  myMapped = nullptr;
+  myMappedSize = 0;
+  myData = nullptr;
+  mySize = 0;
+}
+
+bool ReportCache::Store(const std::string& theKey, const std::string& theFingerprint, const std::string& thePayload)
+{
+#if !defined(_WIN32) && !defined(__EMSCRIPTEN__)
+  if (myDir.empty())
+    return false;
+
+  // create cache directory with missing parents
+  for (size_t aSepPos = myDir.find('/', 1);; aSepPos = myDir.find('/', aSepPos + 1))
+  {
+    const std::string aDir = myDir.substr(0, aSepPos);
+    if (mkdir(aDir.c_str(), 0755) != 0 && errno != EEXIST)
+      return false;
+    if (aSepPos == std::string::npos)
+      break;
+  }
+
+  std::string aData(THE_CACHE_MAGIC, sizeof(THE_CACHE_MAGIC));
+  BinaryData::WriteString(aData, theFingerprint);
+  BinaryData::WriteString(aData, theKey);
+  BinaryData::WriteString(aData, thePayload);
+
+  // write into temporary file and rename it, so that concurrent readers never see partial entry
+  const std::string aPath = entryPath(theKey);
+  const std::string aTmpPath = aPath + ".tmp" + std::to_string((long long)getpid());
+  std::ofstream aFile(aTmpPath.c_str(), std::ios::binary | std::ios::trunc);
+  aFile.write(aData.data(), (std::streamsize)aData.size());
+  aFile.close();
+  if (aFile.fail()
+   || rename(aTmpPath.c_str(), aPath.c_str()) != 0)
+  {
+    unlink(aTmpPath.c_str());
+    return false;
+  }
+  return true;
+#else
+  (void)theKey;
+  (void)theFingerprint;
+  (void)thePayload;
+  return false;
+#endif
+}
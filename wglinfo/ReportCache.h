@@ -0,0 +1,79 @@
+// Copyright © Kirill Gavrilov, 2026
+//
+// This code is licensed under MIT license (see LICENSE.txt for details).
+
+#ifndef REPORTCACHE_HEADER
+#define REPORTCACHE_HEADER
+
+#include <cstddef>
+#include <string>
+
+//! On-disk cache of reports keyed by driver identity.
+//! Each entry is stored in a dedicated file within cache directory ($XDG_CACHE_HOME/wglinfo)
+//! together with the fingerprint of the driver stack it has been collected on;
+//! entry is considered valid only while fingerprint matches the current one.
+//! Entries are read via memory mapping, so that a cache hit doesn't load any GL driver.
+class ReportCache
+{
+public:
+
+  //! Return TRUE if cache is supported on this platform.
+  static bool IsSupported();
+
+  //! Return default cache directory: $XDG_CACHE_HOME/wglinfo or $HOME/.cache/wglinfo;
+  //! empty string if neither variable is defined.
+  static std::string DefaultDirectory();
+
+  //! Compute fingerprint of the driver stack without loading it:
+  //! resolved libEGL/libGL/vendor DSO paths with sizes and modification times,
+  //! Mesa DRI drivers, GLVND vendor files, DRM device nodes and relevant environment variables.
+  static std::string Fingerprint();
+
+public:
+
+  //! Main constructor.
+  ReportCache(const std::string& theDir = DefaultDirectory()) : myDir(theDir) {}
+
+  //! Destructor.
+  ~ReportCache() { Close(); }
+
+  //! Return cache directory.
+  const std::string& Directory() const { return myDir; }
+
+  //! Map cache entry for specified key.
+  //! @return FALSE if entry doesn't exist, is malformed or has been stored with another fingerprint
+  bool Open(const std::string& theKey, const std::string& theFingerprint);
+
+  //! Return payload of opened entry.
+  const char* Data() const { return myData; }
+
+  //! Return payload size of opened entry.
+  size_t Size() const { return mySize; }
+
+  //! Unmap opened entry.
+  void Close();
+
+  //! Store entry for specified key (replacing existing one).
+  bool Store(const std::string& theKey, const std::string& theFingerprint, const std::string& thePayload);
+
+private:
+
+  //! Return file path of the entry.
+  std::string entryPath(const std::string& theKey) const;
+
+private:
+
+  ReportCache(const ReportCache& ) = delete;
+  ReportCache& operator=(const ReportCache& ) = delete;
+
+private:
+
+  std::string myDir;              //!< cache directory
+  void*       myMapped = nullptr; //!< mapped entry file
+  size_t      myMappedSize = 0;   //!< size of mapped entry file
+  const char* myData = nullptr;   //!< payload within mapped file
+  size_t      mySize = 0;         //!< payload size
+
+};
+
+#endif // REPORTCACHE_HEADER
@@ -0,0 +1,18 @@
+// Copyright © Kirill Gavrilov, 2026
+//
+// This code is licensed under MIT license (see LICENSE.txt for details).
+
+#include "ReportFormatter.h"
+
+#include "JsonReportFormatter.h"
+#include "TextReportFormatter.h"
+
+ReportFormatter* ReportFormatter::Create(Format theFormat, std::ostream& theStream)
+{
+  switch (theFormat)
+  {
+    case Format_Text: return new TextReportFormatter(theStream);
+    case Format_Json: return new JsonReportFormatter(theStream);
+  }
+  return nullptr;
+}
@@ -0,0 +1,86 @@
+// Copyright © Kirill Gavrilov, 2026
+//
+// This code is licensed under MIT license (see LICENSE.txt for details).
+
+#ifndef REPORTFORMATTER_HEADER
+#define REPORTFORMATTER_HEADER
+
+#include "OutputBuffer.h"
+#include "RendererReport.h"
+
+#include <ostream>
+
+//! Interface rendering collected reports into output document of specific format.
+//! Document consists of platform entries (platform info followed by profiles)
+//! and a list of visuals written after all platforms.
+//! Each entry is accumulated within reusable OutputBuffer and written into the stream at once.
+class ReportFormatter
+{
+public:
+
+  //! Output format.
+  enum Format
+  {
+    Format_Text, //!< human-readable text
+    Format_Json, //!< single JSON document
+  };
+
+  //! Create formatter of specified format writing into the stream.
+  static ReportFormatter* Create(Format theFormat, std::ostream& theStream);
+
+public:
+
+  //! Destructor.
+  virtual ~ReportFormatter() {}
+
+  //! Return output stream.
+  std::ostream& Stream() { return myStream; }
+
+  //! Start document with tool information.
+  virtual void BeginDocument(const std::string& theVersion,
+                             const std::string& theArch,
+                             const std::string& theAbout) = 0;
+
+  //! Finish document.
+  virtual void EndDocument() = 0;
+
+  //! Start platform entry; writes platform info, if it has been collected within the report.
+  virtual void BeginPlatform(const RendererReport& theInfo) = 0;
+
+  //! Finish platform entry.
+  virtual void EndPlatform() = 0;
+
+  //! Write profile (renderer info, GPU memory, extensions and limits collected within the report).
+  virtual void WriteProfile(const RendererReport& theReport) = 0;
+
+  //! Finish list of platforms and start list of visuals.
+  virtual void BeginVisualsList() = 0;
+
+  //! Write visuals collected within the report.
+  virtual void WriteVisuals(const RendererReport& theReport) = 0;
+
+  //! Write a fragment produced by another formatter of the same format
+  //! (e.g. platform entry or visuals filled within another thread).
+  virtual void WriteFragment(const std::string& theFragment) = 0;
+
+protected:
+
+  //! Main constructor.
+  ReportFormatter(std::ostream& theStream) : myStream(theStream) {}
+
+  //! Write accumulated entry into the stream.
+  void flushBuffer() { myBuffer.Flush(myStream); }
+
+private:
+
+  ReportFormatter(const ReportFormatter& ) = delete;
+  ReportFormatter& operator=(const ReportFormatter& ) = delete;
+
+protected:
+
+  std::ostream& myStream;
+  OutputBuffer  myBuffer; //!< buffer accumulating current entry
+
+};
+
+#endif // REPORTFORMATTER_HEADER
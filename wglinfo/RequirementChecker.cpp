@@ -0,0 +1,323 @@
+// Copyright © Kirill Gavrilov, 2026
+//
+// This code is licensed under MIT license (see LICENSE.txt for details).
+
+#include "RequirementChecker.h"
+
+#include <algorithm>
+#include <cctype>
+#include <cstdlib>
+#include <cstring>
+
+namespace
+{
+  //! Return TRUE if string starts with specified prefix.
+  static bool startsWith(const std::string& theStr, const char* thePrefix)
+  {
+    return theStr.compare(0, strlen(thePrefix), thePrefix) == 0;
+  }
+
+  //! Parse integer occupying the whole string.
+  static bool parseInteger(const std::string& theStr, long long& theVal)
+  {
+    if (theStr.empty())
+      return false;
+
+    char* anEnd = nullptr;
+    theVal = strtoll(theStr.c_str(), &anEnd, 10);
+    return anEnd != nullptr && *anEnd == '\0';
+  }
+}
+
+bool RequirementChecker::compare(long long theVal, Compare theCmp, long long theRef)
+{
+  switch (theCmp)
+  {
+    case Compare_Less:         return theVal <  theRef;
+    case Compare_LessEqual:    return theVal <= theRef;
+    case Compare_Equal:        return theVal == theRef;
+    case Compare_NotEqual:     return theVal != theRef;
+    case Compare_GreaterEqual: return theVal >= theRef;
+    case Compare_Greater:      return theVal >  theRef;
+  }
+  return false;
+}
+
+bool RequirementChecker::parseVersion(const char* theStr, long long& theVersion, bool theIsExact)
+{
+  // skip prefix like "OpenGL ES " or "OpenGL ES-CM "
+  const char* aStr = theStr;
+  for (; *aStr != '\0' && !isdigit((unsigned char )*aStr); ++aStr) {}
+
+  char* anEnd = nullptr;
+  const long aMajor = strtol(aStr, &anEnd, 10);
+  if (anEnd == aStr || *anEnd != '.')
+    return false;
+
+  const char* aMinorStr = anEnd + 1;
+  const long aMinor = strtol(aMinorStr, &anEnd, 10);
+  if (anEnd == aMinorStr
+   || (theIsExact && (aStr != theStr || *anEnd != '\0')))
+    return false;
+
+  theVersion = (long long )aMajor * 1000 + aMinor;
+  return true;
+}
+
+bool RequirementChecker::Add(const std::string& theExpr)
+{
+  Requirement aReq;
+  aReq.Expression = theExpr;
+  std::string aSubject = theExpr;
+  std::string aValue;
+  static const struct { const char* Name; Compare Cmp; } THE_OPERATORS[] =
+  {
+    // two-character operators should be checked first
+    { ">=", Compare_GreaterEqual }, { "<=", Compare_LessEqual }, { "==", Compare_Equal },
+    { "!=", Compare_NotEqual },     { ">",  Compare_Greater },   { "<",  Compare_Less }, { "=", Compare_Equal },
+  };
+  bool hasOperator = false;
+  for (const auto& anOp : THE_OPERATORS)
+  {
+    const size_t aPos = theExpr.find(anOp.Name);
+    if (aPos != std::string::npos)
+    {
+      aSubject = theExpr.substr(0, aPos);
+      aValue = theExpr.substr(aPos + strlen(anOp.Name));
+      aReq.ReqCompare = anOp.Cmp;
+      hasOperator = true;
+      break;
+    }
+  }
+
+  if (startsWith(aSubject, "ext:"))
+  {
+    aReq.ReqKind = Kind_Extension;
+    aReq.Name = aSubject.substr(4);
+    if (hasOperator || aReq.Name.empty())
+      return false;
+  }
+  else if (startsWith(aSubject, "limit:"))
+  {
+    aReq.ReqKind = Kind_Limit;
+    aReq.Name = aSubject.substr(6);
+    const std::vector<std::string> aLimitNames = BaseGlContext::LimitNames();
+    if (!hasOperator
+     || std::find(aLimitNames.begin(), aLimitNames.end(), aReq.Name) == aLimitNames.end()
+     || !parseInteger(aValue, aReq.Value))
+      return false;
+  }
+  else if (aSubject == "gpumem" || aSubject == "gpumemory")
+  {
+    aReq.ReqKind = Kind_GpuMemory;
+    if (!hasOperator || !parseInteger(aValue, aReq.Value))
+      return false;
+  }
+  else if (aSubject == "gl" || aSubject == "gles")
+  {
+    aReq.ReqKind = aSubject == "gl" ? Kind_GlVersion : Kind_GlesVersion;
+    long long aMajor = 0;
+    if (!hasOperator || aValue.empty() || !isdigit((unsigned char )aValue[0]))
+      return false;
+    else if (parseInteger(aValue, aMajor))
+      aReq.Value = aMajor * 1000;
+    else if (!parseVersion(aValue.c_str(), aReq.Value, true))
+      return false;
+  }
+  else
+  {
+    return false;
+  }
+  myReqs.push_back(aReq);
+
+  // version requirements define requested APIs
+  myTargets.clear();
+  for (const Requirement& aReqIter : myReqs)
+  {
+    const Target aTarget = aReqIter.ReqKind == Kind_GlVersion ? Target_Gl : Target_Gles;
+    if ((aReqIter.ReqKind == Kind_GlVersion || aReqIter.ReqKind == Kind_GlesVersion)
+     && std::find(myTargets.begin(), myTargets.end(), aTarget) == myTargets.end())
+    {
+      myTargets.push_back(aTarget);
+    }
+  }
+  if (myTargets.empty())
+    myTargets.push_back(Target_Any);
+  myMetBy.assign(myTargets.size(), std::string());
+  return true;
+}
+
+int RequirementChecker::Sections() const
+{
+  // renderer strings are always collected to describe the result
+  int aSections = RendererReport::Section_Renderer;
+  for (const Requirement& aReq : myReqs)
+  {
+    switch (aReq.ReqKind)
+    {
+      case Kind_GlVersion:
+      case Kind_GlesVersion:
+        break;
+      case Kind_Extension:
+        aSections |= RendererReport::Section_Platform | RendererReport::Section_Extensions;
+        break;
+      case Kind_Limit:
+        aSections |= RendererReport::Section_Limits;
+        break;
+      case Kind_GpuMemory:
+        aSections |= RendererReport::Section_GpuMemory;
+        break;
+    }
+  }
+  return aSections;
+}
+
+bool RequirementChecker::IsSatisfied() const
+{
+  for (const std::string& aMetBy : myMetBy)
+  {
+    if (aMetBy.empty())
+      return false;
+  }
+  return !myMetBy.empty();
+}
+
+std::string RequirementChecker::Reason() const
+{
+  if (IsSatisfied())
+  {
+    std::string aReason = "Requirements are met by ";
+    for (size_t aTargetIter = 0; aTargetIter < myMetBy.size(); ++aTargetIter)
+      aReason += (aTargetIter != 0 ? ", " : "") + myMetBy[aTargetIter];
+    return aReason;
+  }
+  else if (myNbProfiles == 0)
+  {
+    return "Requirements are not met: no context has been created";
+  }
+  return "Requirements are not met: " + myLastFailure;
+}
+
+void RequirementChecker::OnPlatform(const RendererReport& theInfo)
+{
+  myPlatformExts.clear();
+  for (const RendererReport::Property& aProp : theInfo.PlatformInfo)
+    myPlatformExts.insert(myPlatformExts.end(), aProp.List.begin(), aProp.List.end());
+}
+
+bool RequirementChecker::ToProbe(BaseGlContext::ContextBits theBits) const
+{
+  for (size_t aTargetIter = 0; aTargetIter < myTargets.size(); ++aTargetIter)
+  {
+    if (myMetBy[aTargetIter].empty()
+     && isTargetApi(myTargets[aTargetIter], theBits))
+    {
+      return true;
+    }
+  }
+  return false;
+}
+
+void RequirementChecker::OnProfile(const RendererReport& theReport)
+{
+  const BaseGlContext::ContextBits aBits = (BaseGlContext::ContextBits )theReport.ContextBits;
+  const std::string aLabel = BaseGlContext::ProbeLabel(theReport.Platform.c_str(), aBits);
+  ++myNbProfiles;
+  for (size_t aTargetIter = 0; aTargetIter < myTargets.size(); ++aTargetIter)
+  {
+    const Target aTarget = myTargets[aTargetIter];
+    if (!myMetBy[aTargetIter].empty()
+     || !isTargetApi(aTarget, aBits))
+    {
+      continue;
+    }
+
+    bool isMet = true;
+    for (const Requirement& aReq : myReqs)
+    {
+      // version of another API doesn't restrict this target
+      if ((aReq.ReqKind == Kind_GlVersion   && aTarget != Target_Gl)
+       || (aReq.ReqKind == Kind_GlesVersion && aTarget != Target_Gles))
+      {
+        continue;
+      }
+
+      std::string aFound;
+      if (!evaluate(aReq, theReport, aFound))
+      {
+        myLastFailure = aReq.Expression + " (" + aFound + " in " + aLabel + ")";
+        isMet = false;
+        break;
+      }
+    }
+    if (isMet)
+      myMetBy[aTargetIter] = aLabel;
+  }
+}
+
+bool RequirementChecker::evaluate(const Requirement& theReq,
+                                  const RendererReport& theReport,
+                                  std::string& theFound) const
+{
+  switch (theReq.ReqKind)
+  {
+    case Kind_GlVersion:
+    case Kind_GlesVersion:
+    {
+      long long aVersion = 0;
+      if (!parseVersion(theReport.Version.c_str(), aVersion))
+      {
+        theFound = "unknown version";
+        return false;
+      }
+      theFound = "found " + std::to_string(aVersion / 1000) + "." + std::to_string(aVersion % 1000);
+      return compare(aVersion, theReq.ReqCompare, theReq.Value);
+    }
+    case Kind_Extension:
+    {
+      if (std::find(theReport.Extensions.begin(), theReport.Extensions.end(), theReq.Name) != theReport.Extensions.end()
+       || std::find(myPlatformExts.begin(), myPlatformExts.end(), theReq.Name) != myPlatformExts.end())
+      {
+        return true;
+      }
+      theFound = "not found";
+      return false;
+    }
+    case Kind_Limit:
+    {
+      for (const RendererReport::Limit& aLimit : theReport.Limits)
+      {
+        if (aLimit.Name != theReq.Name)
+          continue;
+
+        // every value of a range should satisfy the requirement
+        theFound = "found";
+        bool isMet = true;
+        for (int aValIter = 0; aValIter < aLimit.NbVals; ++aValIter)
+        {
+          theFound += (aValIter != 0 ? ", " : " ") + std::to_string(aLimit.Values[aValIter]);
+          isMet = isMet && compare(aLimit.Values[aValIter], theReq.ReqCompare, theReq.Value);
+        }
+        return isMet;
+      }
+      theFound = "unknown limit";
+      return false;
+    }
+    case Kind_GpuMemory:
+    {
+      if (theReport.GpuMemoryInfo.empty())
+      {
+        theFound = "unknown GPU memory";
+        return false;
+      }
+
+      // the largest reported value is the closest one to the total memory
+      int aMiB = 0;
+      for (const RendererReport::GpuMemory& aMem : theReport.GpuMemoryInfo)
+        aMiB = std::max(aMiB, aMem.MiB);
+      theFound = "found " + std::to_string(aMiB) + " MiB";
+      return compare(aMiB, theReq.ReqCompare, theReq.Value);
+    }
+  }
+  return false;
+}
@@ -0,0 +1,135 @@
+// Copyright © Kirill Gavrilov, 2026
+//
+// This code is licensed under MIT license (see LICENSE.txt for details).
+
+#ifndef REQUIREMENTCHECKER_HEADER
+#define REQUIREMENTCHECKER_HEADER
+
+#include "RendererProbe.h"
+
+#include <string>
+#include <vector>
+
+//! Checker of capability requirements like "gl>=4.5", "gles>=3.2", "ext:GL_ARB_bindless_texture",
+//! "limit:GL_MAX_TEXTURE_SIZE>=16384" or "gpumem>=8192" evaluated against probed profiles.
+//!
+//! Requirements are met when every requested API (OpenGL for "gl", OpenGL ES for "gles",
+//! any API when neither is specified) has a context satisfying its version requirement
+//! together with all extension, limit and GPU memory requirements.
+//! The checker is a probe listener skipping profiles that cannot influence the answer anymore,
+//! so that probing stops as soon as requirements are met.
+class RequirementChecker : public RendererProbe::Listener
+{
+public:
+
+  //! Empty constructor.
+  RequirementChecker() {}
+
+  //! Parse and add requirement expression.
+  //! @return FALSE on syntax error
+  bool Add(const std::string& theExpr);
+
+  //! Return TRUE if no requirements have been added.
+  bool IsEmpty() const { return myReqs.empty(); }
+
+  //! Return RendererReport::Section mask of information needed to evaluate requirements.
+  int Sections() const;
+
+  //! Return TRUE if all requirements are met.
+  bool IsSatisfied() const;
+
+  //! Return one-line description of the result.
+  std::string Reason() const;
+
+public:
+
+  //! Remember platform extensions.
+  virtual void OnPlatform(const RendererReport& theInfo) override;
+
+  //! Evaluate requirements against profile.
+  virtual void OnProfile(const RendererReport& theReport) override;
+
+  //! Forget platform extensions.
+  virtual void OnPlatformEnd() override { myPlatformExts.clear(); }
+
+  //! Remember probe failure.
+  virtual void OnError(const std::string& theMessage) override { myErrors.push_back(theMessage); }
+
+  //! Return TRUE if profile may satisfy API which is not yet satisfied.
+  virtual bool ToProbe(BaseGlContext::ContextBits theBits) const override;
+
+  //! Return list of probe failures.
+  const std::vector<std::string>& Errors() const { return myErrors; }
+
+private:
+
+  //! Requirement kind.
+  enum Kind
+  {
+    Kind_GlVersion,   //!< "gl"     - OpenGL version
+    Kind_GlesVersion, //!< "gles"   - OpenGL ES version
+    Kind_Extension,   //!< "ext:"   - renderer or platform extension
+    Kind_Limit,       //!< "limit:" - renderer limit
+    Kind_GpuMemory,   //!< "gpumem" - GPU memory in MiB
+  };
+
+  //! Comparison operator.
+  enum Compare
+  {
+    Compare_Less,
+    Compare_LessEqual,
+    Compare_Equal,
+    Compare_NotEqual,
+    Compare_GreaterEqual,
+    Compare_Greater,
+  };
+
+  //! Parsed requirement.
+  struct Requirement
+  {
+    std::string Expression;          //!< original expression
+    Kind        ReqKind = Kind_Extension;
+    Compare     ReqCompare = Compare_GreaterEqual;
+    std::string Name;                //!< extension or limit name
+    long long   Value = 0;           //!< compared value; version is encoded as Major * 1000 + Minor
+  };
+
+  //! Requested API.
+  enum Target
+  {
+    Target_Gl,   //!< OpenGL context
+    Target_Gles, //!< OpenGL ES context
+    Target_Any,  //!< any context
+  };
+
+  //! Return TRUE if profile of specified API may satisfy the target.
+  static bool isTargetApi(Target theTarget, BaseGlContext::ContextBits theBits)
+  {
+    return theTarget == Target_Any
+        || (theTarget == Target_Gles) == ((theBits & BaseGlContext::ContextBits_GLES) != 0);
+  }
+
+  //! Compare values.
+  static bool compare(long long theVal, Compare theCmp, long long theRef);
+
+  //! Parse version "Major.Minor" from version string like "4.6 (Core Profile)" or "OpenGL ES 3.2".
+  //! @param theIsExact when TRUE, string should contain nothing but "Major.Minor"
+  static bool parseVersion(const char* theStr, long long& theVersion, bool theIsExact = false);
+
+  //! Evaluate requirement against profile.
+  //! @param theFound [out] description of found value for failed requirement
+  bool evaluate(const Requirement& theReq, const RendererReport& theReport, std::string& theFound) const;
+
+private:
+
+  std::vector<Requirement> myReqs;          //!< parsed requirements
+  std::vector<Target>      myTargets;       //!< requested APIs
+  std::vector<std::string> myMetBy;         //!< profile label satisfying each target, empty if not yet met
+  std::vector<std::string> myPlatformExts;  //!< extensions of current platform
+  std::vector<std::string> myErrors;        //!< probe failures
+  std::string              myLastFailure;   //!< reason of the last profile rejection
+  int                      myNbProfiles = 0; //!< number of evaluated profiles
+
+};
+
+#endif // REQUIREMENTCHECKER_HEADER
@@ -0,0 +1,347 @@
+// Copyright © Kirill Gavrilov, 2026
+//
+// This code is licensed under MIT license (see LICENSE.txt for details).
+
+#include "TextReportFormatter.h"
+
+#include "BaseGlContext.h"
+
+static const int THE_LINE_LEN = 80;
+
+void TextReportFormatter::BeginDocument(const std::string& ,
+                                        const std::string& ,
+                                        const std::string& theAbout)
+{
+  myBuffer << theAbout << "\n\n";
+  flushBuffer();
+}
+
+void TextReportFormatter::BeginPlatform(const RendererReport& theInfo)
+{
+  if (!theInfo.HasSection(RendererReport::Section_Platform))
+    return;
+
+  const std::string aPrefix = !theInfo.PlatformPrefix.empty()
+                            ? theInfo.PlatformPrefix
+                            : "[" + theInfo.Platform + "] ";
+  for (const RendererReport::Property& aProp : theInfo.PlatformInfo)
+  {
+    if (aProp.IsList)
+    {
+      myBuffer << aPrefix << aProp.Label << ":\n";
+      printExtensions(aProp.List, aProp.IsNull);
+      continue;
+    }
+
+    std::string aLabel = aProp.Label + ":";
+    if ((int)aLabel.size() < theInfo.PlatformLabelWidth)
+      aLabel.resize(theInfo.PlatformLabelWidth, ' ');
+    myBuffer << aPrefix << aLabel << " " << aProp.Value << "\n";
+  }
+  flushBuffer();
+}
+
+void TextReportFormatter::WriteProfile(const RendererReport& theReport)
+{
+  const std::string aPrefix = BaseGlContext::ProbeLabel(theReport.Platform.c_str(),
+                                                        (BaseGlContext::ContextBits )theReport.ContextBits) + " ";
+  if (theReport.HasSection(RendererReport::Section_Renderer))
+  {
+    myBuffer << aPrefix << "vendor   string: " << theReport.Vendor   << "\n"
+             << aPrefix << "renderer string: " << theReport.Renderer << "\n"
+             << aPrefix << "version  string: " << theReport.Version  << "\n";
+    if (theReport.HasShadingLanguageVersion)
+      myBuffer << aPrefix << "shading language version string: " << theReport.ShadingLanguageVersion << "\n";
+  }
+
+  if (theReport.HasSection(RendererReport::Section_GpuMemory))
+  {
+    for (const RendererReport::GpuMemory& aMem : theReport.GpuMemoryInfo)
+      myBuffer << aPrefix << aMem.Label << ": " << aMem.MiB << " MiB\n";
+  }
+
+  if (theReport.HasSection(RendererReport::Section_Extensions))
+  {
+    myBuffer << aPrefix << "extensions:\n";
+    printExtensions(theReport.Extensions, false);
+  }
+
+  if (theReport.HasSection(RendererReport::Section_Limits))
+  {
+    myBuffer << aPrefix << "limits:\n";
+    for (const RendererReport::Limit& aLim : theReport.Limits)
+    {
+      myBuffer << "  " << aLim.Name << " = " << aLim.Values[0];
+      if (aLim.NbVals == 2)
+        myBuffer << ", " << aLim.Values[1];
+      myBuffer << '\n';
+    }
+
+    if (!theReport.ShadingLanguageVersions.empty())
+    {
+      myBuffer << "  GL_SHADING_LANGUAGE_VERSION =";
+      size_t aLineLen = THE_LINE_LEN * 2;
+      for (size_t aVerIter = 0; aVerIter < theReport.ShadingLanguageVersions.size(); ++aVerIter)
+      {
+        const std::string& aName = theReport.ShadingLanguageVersions[aVerIter];
+        aLineLen += aName.length();
+        if (aLineLen > THE_LINE_LEN)
+        {
+          myBuffer << "\n    ";
+          aLineLen = aName.length() + 4;
+        }
+        else if (aVerIter > 0)
+        {
+          myBuffer << ", ";
+        }
+        myBuffer << aName;
+      }
+      myBuffer << '\n';
+    }
+  }
+  flushBuffer();
+}
+
+void TextReportFormatter::WriteVisuals(const RendererReport& theReport)
+{
+  if (!theReport.HasSection(RendererReport::Section_Visuals))
+    return;
+
+  myBuffer << "\n[" << theReport.Platform << "] " << theReport.VisualsTitle << "\n";
+  if (!theReport.IsVerboseVisuals)
+    PrintTableHeader(myBuffer, true);
+
+  for (size_t aVisIter = 0; aVisIter <= theReport.Visuals.size(); ++aVisIter)
+  {
+    if ((int)aVisIter == theReport.VisualsSeparator)
+      PrintTableSeparator(myBuffer);
+    if (aVisIter == theReport.Visuals.size())
+      break;
+
+    if (aVisIter < theReport.VisualDetails.size())
+      myBuffer << theReport.VisualDetails[aVisIter];
+    else
+      PrintTableLine(myBuffer, theReport.Visuals[aVisIter], theReport.IsHexConfigId);
+  }
+
+  // table footer
+  if (!theReport.IsVerboseVisuals)
+    PrintTableHeader(myBuffer, false);
+  flushBuffer();
+}
+
+void TextReportFormatter::printExtensions(const std::vector<std::string>& theList, bool theIsNull)
+{
+  if (theIsNull)
+  {
+    PrintExtensions(myBuffer, nullptr);
+    return;
+  }
+
+  const std::string anExtList = RendererReport::JoinExtensions(theList);
+  PrintExtensions(myBuffer, anExtList.c_str());
+}
+
+void TextReportFormatter::PrintExtensions(OutputBuffer& theBuffer, const char* theExt)
+{
+  if (theExt == nullptr)
+  {
+    theBuffer << "    NULL.\n\n";
+    return;
+  }
+
+  int aStart = 0, aLineLen = 0;
+  for (int aCharIter = 0;; ++aCharIter)
+  {
+    bool toBreak = theExt[aCharIter] == '\0';
+    if (theExt[aCharIter] == ' '
+     || theExt[aCharIter] == '\0')
+    {
+      const int aLen = aCharIter - aStart;
+      for (; theExt[aCharIter] == ' '; ++aCharIter) {} // skip extra spaces
+      if (theExt[aCharIter] == '\0')
+        toBreak = true;
+
+      if (aLen > 0)
+      {
+        if (aLineLen != 0 && aLineLen + aLen + 2 > THE_LINE_LEN)
+        {
+          theBuffer << '\n';
+          aLineLen = 0;
+        }
+        if (aLineLen == 0)
+        {
+          aLineLen += 4;
+          theBuffer << "    ";
+        }
+        else
+        {
+          aLineLen += 1;
+          theBuffer << ' ';
+        }
+
+        aLineLen += aLen + 1;
+        theBuffer.Append(theExt + aStart, size_t(aLen));
+        theBuffer << (toBreak ? '.' : ',');
+      }
+      aStart = aCharIter;
+    }
+    if (toBreak)
+    {
+      theBuffer << "\n\n";
+      return;
+    }
+  }
+}
+
+void TextReportFormatter::PrintTableSeparator(OutputBuffer& theBuffer)
+{
+  theBuffer << "  - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - \n";
+}
+
+void TextReportFormatter::PrintTableHeader(OutputBuffer& theBuffer, bool theHeader)
+{
+  if (theHeader)
+  {
+    theBuffer << "      visual  bf lv rg d st  colorbuffer  sr ax dp st accumbuffer msaa  cav\n"
+                 "  id  dep cl  sz l  ci b ro  r  g  b  a F gb bf th cl  r  g  b  a ns  b eat\n"
+                 "------------------------------------------------------------------------\n";
+  }
+  else
+  {
+    theBuffer << "------------------------------------------------------------------------\n"
+                 "  id  dep cl  bf lv rg d st  r  g  b  a F sr ax dp st  r  g  b  a ns  b cav\n"
+                 "      visual  sz l  ci b ro  colorbuffer  gb bf th cl accumbuffer msaa  eat\n"
+                 "------------------------------------------------------------------------\n\n";
+  }
+}
+
+void TextReportFormatter::PrintTableLine(OutputBuffer& theBuffer,
+                                         const RendererReport::VisualInfo& theInfo,
+                                         bool theIsHexConfigId)
+{
+  typedef RendererReport::VisualInfo VisualInfo;
+
+  const auto printInt2d = [&theBuffer](int theInt, int theNA = -1) -> void
+  {
+    if (theInt <= theNA)
+      theBuffer << " . ";
+    else
+      theBuffer.AppendInt(theInt, 2) << " ";
+  };
+
+  const auto printInt3d = [&theBuffer](int theInt) -> void
+  {
+    if (theInt < 0)
+      theBuffer << "  . ";
+    else
+      theBuffer.AppendInt(theInt, 3) << " ";
+  };
+
+  if (theIsHexConfigId && theInfo.ConfigId >= 0x1000)
+    theBuffer.AppendHex((unsigned int )theInfo.ConfigId, 5) << " ";
+  else if (theIsHexConfigId)
+    (theBuffer << "0x").AppendHex((unsigned int )theInfo.ConfigId, 3) << " ";
+  else
+    theBuffer.AppendInt(theInfo.ConfigId, 5) << " ";
+
+  if (theInfo.ColorDepth == 0 && theInfo.ColorBufferSize != 0 && theInfo.BufferType == VisualInfo::ColorBuffer_Rgba)
+  {
+    // color depth excluding alpha
+    if (theInfo.RedSize != 0)
+      printInt3d(theInfo.RedSize + theInfo.GreenSize + theInfo.BlueSize);
+    else if (theInfo.AlphaSize == 2 && theInfo.ColorBufferSize == 32)
+      printInt3d(30);
+    else if (theInfo.AlphaSize == 8 && theInfo.ColorBufferSize == 32)
+      printInt3d(24);
+    else
+      printInt3d(theInfo.ColorBufferSize);
+  }
+  else
+  {
+    printInt3d(theInfo.ColorDepth);
+  }
+
+  const int aSurfBuffers = VisualInfo::Surface_Pixmap | VisualInfo::Surface_PBuffer | VisualInfo::Surface_PBufferRemote;
+  if ((theInfo.SurfaceType & VisualInfo::Surface_Window) != 0)
+  {
+    if ((theInfo.SurfaceType & aSurfBuffers) != 0)
+      theBuffer << "wb ";
+    else
+      theBuffer << "wn ";
+  }
+  else if ((theInfo.SurfaceType & aSurfBuffers) != 0)
+  {
+    theBuffer << "bm ";
+  }
+  else
+  {
+    theBuffer << " . ";
+  }
+
+  // x sp
+  //theBuffer << " . ";
+
+  // color buffer size
+  printInt3d(theInfo.ColorBufferSize);
+
+  // number of over/underlays
+  theBuffer << " . ";
+
+  // color type
+  switch (theInfo.BufferType)
+  {
+    case VisualInfo::ColorBuffer_ColorIndex: theBuffer << 'i'; break;
+    case VisualInfo::ColorBuffer_Luminance:  theBuffer << 'l'; break;
+    case VisualInfo::ColorBuffer_Rgba:       theBuffer << 'r'; break;
+  }
+  theBuffer << "  ";
+
+  // double buffer
+  theBuffer << (theInfo.SwapIntervalMax >= 1 ? 'y' : '.') << " ";
+
+  // stereo buffer
+  theBuffer << (theInfo.IsStereoBuffer ? 'y' : '.') << "  ";
+
+  // RGBA components bits
+  const int aNA = theInfo.BufferType != VisualInfo::ColorBuffer_Rgba ? 0 : -1;
+  printInt2d(theInfo.RedSize,   aNA);
+  printInt2d(theInfo.GreenSize, aNA);
+  printInt2d(theInfo.BlueSize,  aNA);
+  printInt2d(theInfo.AlphaSize, aNA);
+  // float
+  theBuffer << (theInfo.IsColorFloat ? 'y' : '.') << " ";
+  // srgb
+  theBuffer << " " << (theInfo.IsSRgb ? 's' : '.') << " ";
+
+  printInt2d(theInfo.NbAuxBuffers, 0);
+  printInt2d(theInfo.DepthSize);
+  printInt2d(theInfo.StencilSize);
+
+  // accumulation buffer components bits
+  printInt2d(theInfo.AccumRedSize,   0);
+  printInt2d(theInfo.AccumGreenSize, 0);
+  printInt2d(theInfo.AccumBlueSize,  0);
+  printInt2d(theInfo.AccumAlphaSize, 0);
+
+  // ms: ns  b
+  theBuffer << " " << theInfo.NbSampleBuffers << " ";
+  printInt2d(theInfo.NbSamples, -1);
+
+  // swap
+  //theBuffer << ".  ";
+
+  // caveat
+  if (theInfo.IsSoftware)
+    theBuffer << "Software ";
+  else if (theInfo.ConfigCaveat == 0)
+    theBuffer << "None ";
+
+  if ((theInfo.ConfigCaveat & VisualInfo::Caveat_Slow) != 0)
+    theBuffer << "Slow ";
+
+  if ((theInfo.ConfigCaveat & VisualInfo::Caveat_NonConformant) != 0)
+    theBuffer << "NonConformant ";
+
+  theBuffer << '\n';
+}
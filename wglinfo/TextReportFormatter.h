@@ -0,0 +1,71 @@
+// Copyright © Kirill Gavrilov, 2026
+//
+// This code is licensed under MIT license (see LICENSE.txt for details).
+
+#ifndef TEXTREPORTFORMATTER_HEADER
+#define TEXTREPORTFORMATTER_HEADER
+
+#include "ReportFormatter.h"
+
+//! Formatter of human-readable text report in glxinfo style.
+class TextReportFormatter : public ReportFormatter
+{
+public:
+
+  //! Main constructor.
+  TextReportFormatter(std::ostream& theStream) : ReportFormatter(theStream) {}
+
+  //! Print tool information.
+  virtual void BeginDocument(const std::string& theVersion,
+                             const std::string& theArch,
+                             const std::string& theAbout) override;
+
+  //! Does nothing.
+  virtual void EndDocument() override {}
+
+  //! Print platform info.
+  virtual void BeginPlatform(const RendererReport& theInfo) override;
+
+  //! Does nothing.
+  virtual void EndPlatform() override {}
+
+  //! Print profile.
+  virtual void WriteProfile(const RendererReport& theReport) override;
+
+  //! Does nothing.
+  virtual void BeginVisualsList() override {}
+
+  //! Print visuals table.
+  virtual void WriteVisuals(const RendererReport& theReport) override;
+
+  //! Print text fragment as is.
+  virtual void WriteFragment(const std::string& theFragment) override
+  {
+    myBuffer << theFragment;
+    flushBuffer();
+  }
+
+public:
+
+  //! Format extensions as a comma separated list with line size fixed to 80.
+  static void PrintExtensions(OutputBuffer& theBuffer, const char* theExt);
+
+  //! Print visuals table header (theHeader=TRUE) or footer (theHeader=FALSE).
+  static void PrintTableHeader(OutputBuffer& theBuffer, bool theHeader);
+
+  //! Print visuals table separator.
+  static void PrintTableSeparator(OutputBuffer& theBuffer);
+
+  //! Print visual as table line.
+  static void PrintTableLine(OutputBuffer& theBuffer,
+                             const RendererReport::VisualInfo& theInfo,
+                             bool theIsHexConfigId = true);
+
+private:
+
+  //! Print list of extensions.
+  void printExtensions(const std::vector<std::string>& theList, bool theIsNull);
+
+};
+
+#endif // TEXTREPORTFORMATTER_HEADER
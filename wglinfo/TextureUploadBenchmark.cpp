@@ -0,0 +1,232 @@
+// Copyright © Kirill Gavrilov, 2026
+//
+// This code is licensed under MIT license (see LICENSE.txt for details).
+
+#include "TextureUploadBenchmark.h"
+
+#include <cstring>
+
+#define GL_MAX_TEXTURE_SIZE          0x0D33
+#define GL_TEXTURE_2D                0x0DE1
+#define GL_TEXTURE_MIN_FILTER        0x2801
+#define GL_NEAREST                   0x2600
+
+#define GL_RED                       0x1903
+#define GL_RGB                       0x1907
+#define GL_RGBA                      0x1908
+#define GL_BGRA                      0x80E1
+#define GL_DEPTH_COMPONENT           0x1902
+#define GL_DEPTH_STENCIL             0x84F9
+
+#define GL_RGB8                      0x8051
+#define GL_RGBA8                     0x8058
+#define GL_R16F                      0x822D
+#define GL_RGBA16F                   0x881A
+#define GL_RGBA32F                   0x8814
+#define GL_DEPTH_COMPONENT24         0x81A6
+#define GL_DEPTH_COMPONENT32F        0x8CAC
+#define GL_DEPTH24_STENCIL8          0x88F0
+
+#define GL_UNSIGNED_BYTE             0x1401
+#define GL_UNSIGNED_INT              0x1405
+#define GL_FLOAT                     0x1406
+#define GL_HALF_FLOAT                0x140B
+#define GL_UNSIGNED_INT_24_8         0x84FA
+
+#define GL_PIXEL_UNPACK_BUFFER       0x88EC
+#define GL_STREAM_DRAW               0x88E0
+#define GL_MAP_WRITE_BIT             0x0002
+#define GL_MAP_INVALIDATE_BUFFER_BIT 0x0008
+#define GL_MAP_PERSISTENT_BIT        0x0040
+#define GL_MAP_COHERENT_BIT          0x0080
+
+namespace
+{
+  //! Uploaded formats.
+  static const TextureUploadBenchmark::Format THE_FORMATS[] =
+  {
+    { "RGBA8",    GL_RGBA8,              GL_RGBA,            GL_UNSIGNED_BYTE,     4 },
+    { "BGRA8",    GL_RGBA8,              GL_BGRA,            GL_UNSIGNED_BYTE,     4 },
+    { "RGB8",     GL_RGB8,               GL_RGB,             GL_UNSIGNED_BYTE,     3 },
+    { "R16F",     GL_R16F,               GL_RED,             GL_HALF_FLOAT,        2 },
+    { "RGBA16F",  GL_RGBA16F,            GL_RGBA,            GL_HALF_FLOAT,        8 },
+    { "RGBA32F",  GL_RGBA32F,            GL_RGBA,            GL_FLOAT,            16 },
+    { "D24",      GL_DEPTH_COMPONENT24,  GL_DEPTH_COMPONENT, GL_UNSIGNED_INT,      4 },
+    { "D32F",     GL_DEPTH_COMPONENT32F, GL_DEPTH_COMPONENT, GL_FLOAT,             4 },
+    { "D24S8",    GL_DEPTH24_STENCIL8,   GL_DEPTH_STENCIL,   GL_UNSIGNED_INT_24_8, 4 },
+  };
+
+  //! Transfer path names.
+  static const char* THE_PATH_NAMES[] = { "client", "pbo", "pbo-pst" };
+
+  //! Limit of a single image size to keep memory usage reasonable.
+  static const double THE_MAX_IMAGE_BYTES = 64.0 * 1024.0 * 1024.0;
+}
+
+bool TextureUploadBenchmark::isSupported(const Format& theFormat) const
+{
+  if (theFormat.PixelFormat == GL_BGRA)
+    return !isGles() || myHasBgra;
+  else if (theFormat.InternalFormat == GL_RGBA8
+        || theFormat.InternalFormat == GL_RGB8)
+    return true;
+
+  // half-float, floating point and sized depth formats are core since OpenGL 3.0 and OpenGL ES 3.0
+  return isGlGreaterEqual(3, 0);
+}
+
+bool TextureUploadBenchmark::init(std::string& theReason)
+{
+  const GlFunctions& aGl = gl();
+  if (aGl.glGenTextures == nullptr
+   || aGl.glTexSubImage2D == nullptr)
+  {
+    theReason = "glTexSubImage2D() is unavailable";
+    return false;
+  }
+
+  // pixel buffer objects are core since OpenGL 2.1 and OpenGL ES 3.0; mapping ranges since OpenGL 3.0
+  const bool hasPbo = isGlGreaterEqual(3, 0)
+                   && aGl.glGenBuffers != nullptr
+                   && aGl.glMapBufferRange != nullptr;
+  myHasPersist = hasPbo
+              && aGl.glBufferStorage != nullptr
+              && (isGles() ? hasExtension("GL_EXT_buffer_storage")
+                           : (isGlGreaterEqual(4, 4) || hasExtension("GL_ARB_buffer_storage")));
+  myHasBgra = hasExtension("GL_EXT_texture_format_BGRA8888");
+
+  int aMaxSize = 0;
+  myCtx->GlGetIntegerv(GL_MAX_TEXTURE_SIZE, &aMaxSize);
+  myUploadCases.clear();
+  for (const Format& aFormat : THE_FORMATS)
+  {
+    if (!isSupported(aFormat))
+      continue;
+
+    for (int aPathIter = Path_Client; aPathIter <= Path_PboPersist; ++aPathIter)
+    {
+      if ((aPathIter == Path_Pbo && !hasPbo)
+       || (aPathIter == Path_PboPersist && !myHasPersist))
+      {
+        continue;
+      }
+
+      for (int aSize = 64; aSize <= aMaxSize; aSize *= 4)
+      {
+        const double aNbBytes = double(aSize) * double(aSize) * double(aFormat.NbBytes);
+        if (aNbBytes > THE_MAX_IMAGE_BYTES)
+          break;
+
+        UploadCase anUpload;
+        anUpload.Fmt = aFormat;
+        anUpload.TransferPath = (Path )aPathIter;
+        anUpload.Size = aSize;
+        myUploadCases.push_back(anUpload);
+
+        Case aCase;
+        aCase.Name = std::string(aFormat.Name) + " " + THE_PATH_NAMES[aPathIter] + " "
+                   + std::to_string(aSize) + "x" + std::to_string(aSize);
+        aCase.NbBytes = aNbBytes;
+        myCases.push_back(aCase);
+      }
+    }
+  }
+  return true;
+}
+
+bool TextureUploadBenchmark::SetupCase(size_t theCase)
+{
+  const GlFunctions& aGl = gl();
+  const UploadCase& anUpload = myUploadCases[theCase];
+  const size_t aNbBytes = size_t(anUpload.Size) * size_t(anUpload.Size) * size_t(anUpload.Fmt.NbBytes);
+
+  // non-zero pattern, so that driver cannot take a shortcut for zero-filled data
+  myData.resize(aNbBytes);
+  for (size_t aByteIter = 0; aByteIter < aNbBytes; ++aByteIter)
+    myData[aByteIter] = (unsigned char )(aByteIter * 7 + 1);
+
+  // OpenGL ES 2.0 and GL_EXT_texture_format_BGRA8888 accept only unsized internal formats
+  const bool isUnsized = isGles()
+                      && (!isGlGreaterEqual(3, 0) || anUpload.Fmt.PixelFormat == GL_BGRA);
+  const bool hasStorage = aGl.glTexStorage2D != nullptr
+                       && !isUnsized
+                       && (isGles() || isGlGreaterEqual(4, 2) || hasExtension("GL_ARB_texture_storage"));
+  aGl.glGenTextures(1, &myTexture);
+  aGl.glBindTexture(GL_TEXTURE_2D, myTexture);
+  aGl.glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_NEAREST);
+  if (hasStorage)
+    aGl.glTexStorage2D(GL_TEXTURE_2D, 1, anUpload.Fmt.InternalFormat, anUpload.Size, anUpload.Size);
+  else
+    aGl.glTexImage2D(GL_TEXTURE_2D, 0, isUnsized ? anUpload.Fmt.PixelFormat : anUpload.Fmt.InternalFormat,
+                     anUpload.Size, anUpload.Size, 0, anUpload.Fmt.PixelFormat, anUpload.Fmt.PixelType, nullptr);
+
+  if (anUpload.TransferPath == Path_Pbo)
+  {
+    aGl.glGenBuffers(1, &myPbo);
+  }
+  else if (anUpload.TransferPath == Path_PboPersist)
+  {
+    aGl.glGenBuffers(1, &myPbo);
+    aGl.glBindBuffer(GL_PIXEL_UNPACK_BUFFER, myPbo);
+    aGl.glBufferStorage(GL_PIXEL_UNPACK_BUFFER, (ptrdiff_t )aNbBytes, nullptr,
+                        GL_MAP_WRITE_BIT | GL_MAP_PERSISTENT_BIT | GL_MAP_COHERENT_BIT);
+    myMapped = aGl.glMapBufferRange(GL_PIXEL_UNPACK_BUFFER, 0, (ptrdiff_t )aNbBytes,
+                                    GL_MAP_WRITE_BIT | GL_MAP_PERSISTENT_BIT | GL_MAP_COHERENT_BIT);
+    aGl.glBindBuffer(GL_PIXEL_UNPACK_BUFFER, 0);
+    if (myMapped == nullptr)
+      return false;
+  }
+  return myCtx->GlGetError() == 0;
+}
+
+void TextureUploadBenchmark::Iterate(size_t theCase)
+{
+  const GlFunctions& aGl = gl();
+  const UploadCase& anUpload = myUploadCases[theCase];
+  const void* aPixels = myData.data();
+  if (anUpload.TransferPath == Path_Pbo)
+  {
+    // orphan previous storage instead of waiting for the pending upload
+    aGl.glBindBuffer(GL_PIXEL_UNPACK_BUFFER, myPbo);
+    aGl.glBufferData(GL_PIXEL_UNPACK_BUFFER, (ptrdiff_t )myData.size(), nullptr, GL_STREAM_DRAW);
+    if (void* aMapped = aGl.glMapBufferRange(GL_PIXEL_UNPACK_BUFFER, 0, (ptrdiff_t )myData.size(),
+                                             GL_MAP_WRITE_BIT | GL_MAP_INVALIDATE_BUFFER_BIT))
+    {
+      memcpy(aMapped, myData.data(), myData.size());
+      aGl.glUnmapBuffer(GL_PIXEL_UNPACK_BUFFER);
+    }
+    aPixels = nullptr;
+  }
+  else if (anUpload.TransferPath == Path_PboPersist)
+  {
+    // runner waits for completion of each iteration, so that mapped memory could be overwritten without fences
+    aGl.glBindBuffer(GL_PIXEL_UNPACK_BUFFER, myPbo);
+    memcpy(myMapped, myData.data(), myData.size());
+    aPixels = nullptr;
+  }
+
+  aGl.glTexSubImage2D(GL_TEXTURE_2D, 0, 0, 0, anUpload.Size, anUpload.Size,
+                      anUpload.Fmt.PixelFormat, anUpload.Fmt.PixelType, aPixels);
+  if (myPbo != 0)
+    aGl.glBindBuffer(GL_PIXEL_UNPACK_BUFFER, 0);
+}
+
+void TextureUploadBenchmark::ReleaseCase(size_t )
+{
+  const GlFunctions& aGl = gl();
+  if (myMapped != nullptr)
+  {
+    aGl.glBindBuffer(GL_PIXEL_UNPACK_BUFFER, myPbo);
+    aGl.glUnmapBuffer(GL_PIXEL_UNPACK_BUFFER);
+    aGl.glBindBuffer(GL_PIXEL_UNPACK_BUFFER, 0);
+    myMapped = nullptr;
+  }
+  if (myPbo != 0)
+    aGl.glDeleteBuffers(1, &myPbo);
+  aGl.glBindTexture(GL_TEXTURE_2D, 0);
+  aGl.glDeleteTextures(1, &myTexture);
+  myPbo = 0;
+  myTexture = 0;
+  myData.clear();
+  myData.shrink_to_fit();
+}
@@ -0,0 +1,83 @@
+// Copyright © Kirill Gavrilov, 2026
+//
+// This code is licensed under MIT license (see LICENSE.txt for details).
+
+#ifndef TEXTUREUPLOADBENCHMARK_HEADER
+#define TEXTUREUPLOADBENCHMARK_HEADER
+
+#include "GlBenchmark.h"
+
+//! Benchmark of glTexSubImage2D() throughput ("tex-upload").
+//! Cases are a matrix of internal formats (color and depth), sizes from 64x64 up to GL_MAX_TEXTURE_SIZE
+//! and transfer paths:
+//! - "client"  - upload from client memory;
+//! - "pbo"     - orphaned pixel unpack buffer filled via glMapBufferRange();
+//! - "pbo-pst" - persistently mapped pixel unpack buffer (GL_ARB_buffer_storage).
+//! Slow paths (like BGRA swizzled by driver on CPU) are exposed by comparing formats with the same size.
+class TextureUploadBenchmark : public GlBenchmark
+{
+public:
+
+  //! Transfer path.
+  enum Path
+  {
+    Path_Client,     //!< client memory
+    Path_Pbo,        //!< orphaned PBO
+    Path_PboPersist, //!< persistently mapped PBO
+  };
+
+  //! Uploaded format.
+  struct Format
+  {
+    const char*  Name;           //!< format name, like "RGBA8"
+    unsigned int InternalFormat; //!< sized internal format
+    unsigned int PixelFormat;    //!< pixel data format
+    unsigned int PixelType;      //!< pixel data type
+    int          NbBytes;        //!< bytes per pixel
+  };
+
+public:
+
+  //! Empty constructor.
+  TextureUploadBenchmark() {}
+
+  //! Allocate texture, source data and PBO of the case.
+  virtual bool SetupCase(size_t theCase) override;
+
+  //! Upload the whole texture.
+  virtual void Iterate(size_t theCase) override;
+
+  //! Release texture, source data and PBO.
+  virtual void ReleaseCase(size_t theCase) override;
+
+protected:
+
+  //! Define cases for formats and paths supported by context.
+  virtual bool init(std::string& theReason) override;
+
+private:
+
+  //! Return TRUE if format is supported by context.
+  bool isSupported(const Format& theFormat) const;
+
+  //! Internal case definition.
+  struct UploadCase
+  {
+    Format Fmt;
+    Path   TransferPath = Path_Client;
+    int    Size = 0;
+  };
+
+private:
+
+  std::vector<UploadCase>    myUploadCases;         //!< definition of each case
+  std::vector<unsigned char> myData;                //!< source image in client memory
+  unsigned int               myTexture = 0;         //!< uploaded texture
+  unsigned int               myPbo = 0;             //!< pixel unpack buffer
+  void*                      myMapped = nullptr;    //!< persistently mapped PBO
+  bool                       myHasBgra = false;     //!< BGRA pixel format support
+  bool                       myHasPersist = false;  //!< persistent mapping support
+
+};
+
+#endif // TEXTUREUPLOADBENCHMARK_HEADER
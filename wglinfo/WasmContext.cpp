@@ -20,8 +20,6 @@
   #endif
 #endif
 
-typedef const GLubyte* (GL_APIENTRY *glGetStringi_t) (GLenum name, GLuint index);
-
 WasmContext::WasmContext(const std::string& theTitle)
 : myWin(theTitle)
 {
@@ -83,8 +81,15 @@ bool WasmContext::CreateGlContext(ContextBits theBits)
     return false;
   }
 
-  const std::string anExtList = getGlExtensions();
-  if (hasExtension(anExtList.c_str(), "GL_WEBGL_debug_renderer_info"))
+  GlFunctions aStaticFuncs;
+  aStaticFuncs.glGetError    = ::glGetError;
+  aStaticFuncs.glGetString   = ::glGetString;
+  aStaticFuncs.glGetStringi  = ::glGetStringi;
+  aStaticFuncs.glGetIntegerv = ::glGetIntegerv;
+  loadGlFunctions(aStaticFuncs);
+
+  const ExtensionSet anExtSet(getGlExtensions());
+  if (anExtSet.Has("GL_WEBGL_debug_renderer_info"))
     emscripten_webgl_enable_extension(myRendCtx, "GL_WEBGL_debug_renderer_info");
 
   return true;
@@ -108,42 +113,17 @@ void* WasmContext::GlGetProcAddress(const char* theFuncName)
   return (void*)emscripten_webgl_get_proc_address(theFuncName);
 }
 
-unsigned int WasmContext::GlGetError()
-{
-  return ::glGetError();
-}
-
-const char* WasmContext::GlGetString(unsigned int theGlEnum)
-{
-  const char* aStr = (const char*)::glGetString(theGlEnum);
-  if (aStr == NULL)
-  {
-    //
-  }
-  return aStr;
-}
-
-const char* WasmContext::GlGetStringi(unsigned int theGlEnum, unsigned int theIndex)
-{
-  glGetStringi_t aGetStringi = NULL;
-  if (!FindProc("glGetStringi", aGetStringi))
-    return NULL;
-
-  return (const char*)aGetStringi(theGlEnum, theIndex);
-}
-
-void WasmContext::GlGetIntegerv(unsigned int theGlEnum, int* theParams)
+void WasmContext::CollectPlatformInfo(RendererReport& theReport, bool )
 {
-  ::glGetIntegerv(theGlEnum, theParams);
-}
+  theReport.Sections |= RendererReport::Section_Platform;
+  theReport.PlatformPrefix = Prefix();
+  theReport.PlatformLabelWidth = 18;
 
-void WasmContext::PrintPlatformInfo(bool )
-{
-  const std::string anExtList = getGlExtensions();
-  if (hasExtension(anExtList.c_str(), "GL_WEBGL_debug_renderer_info"))
+  const ExtensionSet anExtSet(getGlExtensions());
+  if (anExtSet.Has("GL_WEBGL_debug_renderer_info"))
   {
-    std::cout << Prefix() << "unmasked vendor:   " << GlGetString(0x9245) << "\n";
-    std::cout << Prefix() << "unmasked renderer: " << GlGetString(0x9246) << "\n";
+    theReport.AddPlatformProperty("unmaskedVendor",   GlGetString(0x9245), "unmasked vendor");
+    theReport.AddPlatformProperty("unmaskedRenderer", GlGetString(0x9246), "unmasked renderer");
   }
 }
 
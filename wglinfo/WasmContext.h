@@ -35,26 +35,14 @@ public:
 
 public:
 
-  //! Print platform info.
-  virtual void PrintPlatformInfo(bool theToPrintExtensions) override;
+  //! Collect platform info.
+  virtual void CollectPlatformInfo(RendererReport& theReport, bool theToCollectExtensions) override;
 
-  //! Print information about visuals.
-  virtual void PrintVisuals(bool ) override {}
+  //! Collect information about visuals.
+  virtual void CollectVisuals(RendererReport& , bool ) override {}
 
 public:
 
-  //! glGetError() wrapper.
-  virtual unsigned int GlGetError() override;
-
-  //! glGetString() wrapper.
-  virtual const char* GlGetString(unsigned int theGlEnum) override;
-
-  //! glGetStringi() wrapper.
-  virtual const char* GlGetStringi(unsigned int theGlEnum, unsigned int theIndex) override;
-
-  //! glGetIntegerv() wrapper.
-  virtual void GlGetIntegerv(unsigned int theGlEnum, int* theParams) override;
-
   //! Wrapper to system function to retrieve GL function pointer by name.
   virtual void* GlGetProcAddress(const char* theFuncName) override;
 
@@ -11,6 +11,7 @@
 #include <iomanip>
 #include <iostream>
 #include <memory>
+#include <sstream>
 
 #if defined(__GNUC__) && !defined(__INTEL_COMPILER) && !defined(__clang__)
   #if (__GNUC__ > 8) || ((__GNUC__ == 8) && (__GNUC_MINOR__ >= 1))
@@ -20,7 +21,29 @@
 
 #define GLAPIENTRY WINAPI
 
-typedef const GLubyte* (GLAPIENTRY *glGetStringi_t) (GLenum name, GLuint index);
+//! Return OpenGL 1.1 functions exported by opengl32.dll, as wglGetProcAddress() returns NULL for them.
+static GlFunctions staticGlFunctions()
+{
+  GlFunctions aFuncs;
+  aFuncs.glGetError       = ::glGetError;
+  aFuncs.glGetString      = ::glGetString;
+  aFuncs.glGetIntegerv    = ::glGetIntegerv;
+  aFuncs.glFlush          = ::glFlush;
+  aFuncs.glFinish         = ::glFinish;
+  aFuncs.glViewport       = ::glViewport;
+  aFuncs.glClearColor     = ::glClearColor;
+  aFuncs.glClear          = ::glClear;
+  aFuncs.glReadPixels     = ::glReadPixels;
+  aFuncs.glGenTextures    = ::glGenTextures;
+  aFuncs.glDeleteTextures = ::glDeleteTextures;
+  aFuncs.glBindTexture    = ::glBindTexture;
+  aFuncs.glTexParameteri  = ::glTexParameteri;
+  aFuncs.glPixelStorei    = ::glPixelStorei;
+  aFuncs.glTexImage2D     = ::glTexImage2D;
+  aFuncs.glTexSubImage2D  = ::glTexSubImage2D;
+  aFuncs.glGetTexImage    = ::glGetTexImage;
+  return aFuncs;
+}
 
 // WGL_ARB_pixel_format
 #define WGL_NUMBER_PIXEL_FORMATS_ARB            0x2000
@@ -200,6 +223,7 @@ bool WglContext::CreateGlContext(ContextBits theBits)
     if (!MakeCurrent())
       return false;
 
+    loadGlFunctions(staticGlFunctions());
     ///::ShowWindow((HWND)myWin.GetDrawable(), SW_HIDE);
     return true;
   }
@@ -211,8 +235,8 @@ bool WglContext::CreateGlContext(ContextBits theBits)
 
   // in WGL world wglGetProcAddress() returns NULL if extensions is unavailable,
   // so that checking for extension string can be skipped
-  //if (hasExtension(aWglExts, "WGL_ARB_pixel_format"))
-  //if (hasExtension(aWglExts, "WGL_ARB_create_context_profile"))
+  //if (aWglExts.Has("WGL_ARB_pixel_format"))
+  //if (aWglExts.Has("WGL_ARB_create_context_profile"))
   wglChoosePixelFormatARB_t    aChoosePixProc = (wglChoosePixelFormatARB_t)wglGetProcAddress("wglChoosePixelFormatARB");
   wglCreateContextAttribsARB_t aCreateCtxProc = (wglCreateContextAttribsARB_t)wglGetProcAddress("wglCreateContextAttribsARB");
   if (aChoosePixProc == NULL || aCreateCtxProc == NULL)
@@ -310,6 +334,7 @@ bool WglContext::CreateGlContext(ContextBits theBits)
   if (!MakeCurrent())
     return false;
 
+  loadGlFunctions(staticGlFunctions());
   ///::ShowWindow((HWND)myWin.GetDrawable(), SW_HIDE);
   return myRendCtx != NULL;
 }
@@ -332,39 +357,12 @@ void* WglContext::GlGetProcAddress(const char* theFuncName)
   return (void*)wglGetProcAddress(theFuncName);
 }
 
-unsigned int WglContext::GlGetError()
-{
-  return ::glGetError();
-}
-
-const char* WglContext::GlGetString(unsigned int theGlEnum)
-{
-  const char* aStr = (const char*)::glGetString(theGlEnum);
-  if (aStr == NULL)
-  {
-    //
-  }
-  return aStr;
-}
-
-const char* WglContext::GlGetStringi(unsigned int theGlEnum, unsigned int theIndex)
+void WglContext::CollectPlatformInfo(RendererReport& theReport, bool theToCollectExtensions)
 {
-  glGetStringi_t aGetStringi = NULL;
-  if (!FindProc("glGetStringi", aGetStringi))
-    return NULL;
-
-  return (const char*)aGetStringi(theGlEnum, theIndex);
-}
-
-void WglContext::GlGetIntegerv(unsigned int theGlEnum, int* theParams)
-{
-  ::glGetIntegerv(theGlEnum, theParams);
-}
-
-void WglContext::PrintPlatformInfo(bool theToPrintExtensions)
-{
-  std::cout << "[" << PlatformName() << "] WGLName:       opengl32.dll\n";
-  if (!theToPrintExtensions)
+  theReport.Sections |= RendererReport::Section_Platform;
+  theReport.PlatformLabelWidth = 14;
+  theReport.AddPlatformProperty("WGLName", "opengl32.dll");
+  if (!theToCollectExtensions)
     return;
 
   const char* aWglExts = NULL;
@@ -372,13 +370,12 @@ void WglContext::PrintPlatformInfo(bool theToPrintExtensions)
   if (FindProc("wglGetExtensionsStringARB", wglGetExtensionsStringARB))
     aWglExts = wglGetExtensionsStringARB(wglGetCurrentDC());
 
-  std::cout << "[" << PlatformName() << "] WGL extensions:\n";
-  printExtensions(aWglExts);
+  theReport.AddPlatformExtensions("WGLExtensions", "WGL extensions", aWglExts);
 }
 
-void WglContext::PrintGpuMemoryInfo()
+void WglContext::CollectGpuMemoryInfo(RendererReport& theReport)
 {
-  BaseGlContext::PrintGpuMemoryInfo();
+  BaseGlContext::CollectGpuMemoryInfo(theReport);
 
   typedef INT(WINAPI *wglGetGPUInfoAMD_t)(UINT theId, INT theProperty, GLenum theDataType, UINT theSize, void* theData);
   typedef UINT(WINAPI *wglGetContextGPUIDAMD_t)(HGLRC theHglrc);
@@ -393,27 +390,24 @@ void WglContext::PrintGpuMemoryInfo()
     UINT anAmdId = wglGetContextGPUIDAMD((HGLRC)myRendCtx);
     if (anAmdId != 0 && wglGetGPUInfoAMD(anAmdId, 0x21A3, GL_UNSIGNED_INT, sizeof(aVMemMiB), &aVMemMiB) > 0) // WGL_GPU_RAM_AMD = 0x21A3
     {
-      std::cout << Prefix() << "GPU memory: " << aVMemMiB << " MiB\n";
+      theReport.AddGpuMemory("gpuRamMiB", "GPU memory", (int)aVMemMiB);
     }
   }
 }
 
-void WglContext::PrintVisuals(bool theIsVerbose)
+void WglContext::CollectVisuals(RendererReport& theReport, bool theIsVerbose)
 {
   if (myDevCtx == nullptr)
     return;
 
-  std::string aWglExt;
+  ExtensionSet aWglExt;
   wglGetExtensionsStringARB_t wglGetExtensionsStringARB = nullptr;
   if (FindProc("wglGetExtensionsStringARB", wglGetExtensionsStringARB))
-  {
-    if (const char* aWglExtRaw = wglGetExtensionsStringARB(myDevCtx))
-      aWglExt = aWglExtRaw;
-  }
+    aWglExt.Init(wglGetExtensionsStringARB(myDevCtx));
 
-  const bool hasExtColorspace  = hasExtension(aWglExt, "WGL_EXT_colorspace");
-  const bool hasExtMultisample = hasExtension(aWglExt, "WGL_ARB_multisample")
-                              || hasExtension(aWglExt, "WGL_EXT_multisample");
+  const bool hasExtColorspace  = aWglExt.Has("WGL_EXT_colorspace");
+  const bool hasExtMultisample = aWglExt.Has("WGL_ARB_multisample")
+                              || aWglExt.Has("WGL_EXT_multisample");
 
   wglGetPixelFormatAttribivARB_t aGetAttribIProc = nullptr;
   //wglGetPixelFormatAttribfvARB_t aGetAttribFProc = nullptr;
@@ -435,19 +429,19 @@ void WglContext::PrintVisuals(bool theIsVerbose)
   };
 
   const int aNbFormatsBase = DescribePixelFormat(myDevCtx, 0, 0, nullptr);
-  const int aNbFormatsEx   = hasExtension(aWglExt, "WGL_ARB_pixel_format")
+  const int aNbFormatsEx   = aWglExt.Has("WGL_ARB_pixel_format")
                            ? getAttrEx(0, WGL_NUMBER_PIXEL_FORMATS_ARB)
                            : 0;
   const int aNbFormatsAll = aNbFormatsEx > aNbFormatsBase ? aNbFormatsEx : aNbFormatsBase;
 
-  std::cout << "\n[" << PlatformName() << "] " << aNbFormatsAll << " WGL Visuals";
+  std::string aTitle = std::to_string(aNbFormatsAll) + " WGL Visuals";
   if (aNbFormatsEx > aNbFormatsBase)
-    std::cout << " (" << aNbFormatsBase << " basic + " << (aNbFormatsEx - aNbFormatsBase) << " extra)";
-
-  std::cout << "\n";
+    aTitle += std::string(" (") + std::to_string(aNbFormatsBase) + " basic + " + std::to_string(aNbFormatsEx - aNbFormatsBase) + " extra)";
 
-  if (!theIsVerbose)
-    VisualInfo::PrintTableHeader(true);
+  theReport.Sections |= RendererReport::Section_Visuals;
+  theReport.VisualsTitle = aTitle;
+  theReport.IsHexConfigId = false;
+  theReport.IsVerboseVisuals = theIsVerbose;
 
   for (int aFormatIter = 1; aFormatIter <= aNbFormatsAll; ++aFormatIter)
   {
@@ -459,7 +453,7 @@ void WglContext::PrintVisuals(bool theIsVerbose)
     if (aFormatIter > aNbFormatsBase)
     {
       if (aFormatIter == aNbFormatsBase + 1)
-        VisualInfo::PrintTableSeparator();
+        theReport.VisualsSeparator = (int)theReport.Visuals.size();
 
       if (getAttrEx(aFormatIter, WGL_SUPPORT_OPENGL_ARB) == 0)
         continue;
@@ -605,11 +599,9 @@ void WglContext::PrintVisuals(bool theIsVerbose)
       anInfo.IsColorFloat = aPixType == WGL_TYPE_RGBA_FLOAT_ARB;
     }
 
+    theReport.Visuals.push_back(anInfo);
     if (!theIsVerbose)
-    {
-      anInfo.PrintTableLine(false);
       continue;
-    }
 
     const char* aSurfTypeStr = "N/A";
     if ((anInfo.SurfaceType & VisualInfo::Surface_Window) != 0)
@@ -619,7 +611,8 @@ void WglContext::PrintVisuals(bool theIsVerbose)
     else if ((anInfo.SurfaceType & VisualInfo::Surface_Pixmap) != 0)
       aSurfTypeStr = "bitmap";
 
-    std::cout << "Visual ID: " << aFormatIter << "\n"
+    std::stringstream aDetails;
+    aDetails << "Visual ID: " << aFormatIter << "\n"
               << "    color: R" << anInfo.RedSize << "G" << anInfo.GreenSize << "B" << anInfo.BlueSize << "A" << anInfo.AlphaSize
                                 << " (" << getColorBufferClass(anInfo.ColorBufferSize, anInfo.RedSize) << ", " << anInfo.ColorBufferSize
                                 << aColorSpace << ")"
@@ -631,11 +624,8 @@ void WglContext::PrintVisuals(bool theIsVerbose)
               << "    auxBuffers: " << anInfo.NbAuxBuffers
                                     << " accum: R" << anInfo.AccumRedSize << "G" << anInfo.AccumGreenSize << "B" << anInfo.AccumBlueSize << "A" << anInfo.AccumAlphaSize << "\n"
               << "    renderer: " << anAccelStr << " target: " << aSurfTypeStr << "\n";
+    theReport.VisualDetails.push_back(aDetails.str());
   }
-
-  // table footer
-  if (!theIsVerbose)
-    VisualInfo::PrintTableHeader(false);
 }
 
 #endif
@@ -36,13 +36,13 @@ public:
 
 public:
 
-  //! Print WGL platform info.
-  virtual void PrintPlatformInfo(bool theToPrintExtensions) override;
+  //! Collect WGL platform info.
+  virtual void CollectPlatformInfo(RendererReport& theReport, bool theToCollectExtensions) override;
 
-  //! Print GPU memory info.
-  virtual void PrintGpuMemoryInfo() override;
+  //! Collect GPU memory info.
+  virtual void CollectGpuMemoryInfo(RendererReport& theReport) override;
 
-  //! Print information about visuals.
+  //! Collect information about visuals.
   //! A legend:
   //!   visual ~= pixel format descriptor
   //!   id      = pixel format number (integer from 1 - max pixel formats)
@@ -70,22 +70,10 @@ public:
   //!                             - renderer (gdi (software only),
   //!                                         mcd (mini-icd cooperating with generic driver),
   //!                                         icd (standalone driver))
-  virtual void PrintVisuals(bool theIsVerbose) override;
+  virtual void CollectVisuals(RendererReport& theReport, bool theIsVerbose) override;
 
 public:
 
-  //! glGetError() wrapper.
-  virtual unsigned int GlGetError() override;
-
-  //! glGetString() wrapper.
-  virtual const char* GlGetString(unsigned int theGlEnum) override;
-
-  //! glGetStringi() wrapper.
-  virtual const char* GlGetStringi(unsigned int theGlEnum, unsigned int theIndex) override;
-
-  //! glGetIntegerv() wrapper.
-  virtual void GlGetIntegerv(unsigned int theGlEnum, int* theParams) override;
-
   //! Wrapper to system function to retrieve GL function pointer by name.
   virtual void* GlGetProcAddress(const char* theFuncName) override;
 
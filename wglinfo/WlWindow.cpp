@@ -4,6 +4,8 @@
 
 #include "WlWindow.h"
 
+#include "ProbeTimings.h"
+
 #if defined(HAVE_WAYLAND)
 
 #include <cstring>
@@ -36,8 +38,10 @@ bool WlWindow::Create()
 {
   Destroy();
 
+  ProbeTimings::Sentry aConnectTimer("wl_display_connect");
   myWlDisplay.reset(wl_display_connect(nullptr),
                     [](wl_display* theDisp) { theDisp != nullptr ? wl_display_disconnect(theDisp) : (void)theDisp; });
+  aConnectTimer.Stop();
   if (myWlDisplay.get() == nullptr)
   {
     std::cerr << "Error: cannot connect to the Wayland server\n";
@@ -86,8 +90,11 @@ bool WlWindow::Create()
   struct wl_registry* aWlRegistry = wl_display_get_registry(myWlDisplay.get());
   wl_registry_add_listener(aWlRegistry, &aWlListener, this);
   // call attached listener
-  wl_display_dispatch(myWlDisplay.get());
-  wl_display_roundtrip(myWlDisplay.get());
+  {
+    ProbeTimings::Sentry aTimer("wl_display_roundtrip");
+    wl_display_dispatch(myWlDisplay.get());
+    wl_display_roundtrip(myWlDisplay.get());
+  }
   if (myWlCompositor == nullptr)
   {
     std::cerr << "Error: Wayland server has no compositor\n";
@@ -4,6 +4,8 @@
 
 #include "XwWindow.h"
 
+#include "ProbeTimings.h"
+
 #if !defined(_WIN32) && !defined(__APPLE__) && !defined(__EMSCRIPTEN__)
 
 #include <X11/Xlib.h>
@@ -25,6 +27,7 @@ bool XwWindow::Create()
 
   if (myDisplay == NULL)
   {
+    ProbeTimings::Sentry aTimer("XOpenDisplay");
     myDisplay = (NativeXDisplay* )XOpenDisplay(NULL);
   }
   if (myDisplay == NULL)
@@ -51,12 +54,14 @@ bool XwWindow::Create()
   aWinAttr.border_pixel = 0;
   aWinAttr.override_redirect = False;
 
+  ProbeTimings::Sentry aCreateTimer("XCreateWindow");
   myHandle = XCreateWindow(aDisp, aParent,
                            2, 2, 4, 4,
                            0, aVisInfo != NULL ? aVisInfo->depth : CopyFromParent,
                            InputOutput,
                            aVisInfo != NULL ? aVisInfo->visual : CopyFromParent,
                            CWBorderPixel | CWColormap | CWEventMask | CWOverrideRedirect, &aWinAttr);
+  aCreateTimer.Stop();
   if (aVisInfo != NULL)
   {
     XFree(aVisInfo);
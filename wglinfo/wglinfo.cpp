@@ -7,16 +7,30 @@
 //
 // This code is licensed under MIT license (see LICENSE.txt for details).
 
+#include "BenchmarkRunner.h"
+#include "ContextCreateBenchmark.h"
 #include "EglGlContext.h"
 #include "NativeGlContext.h"
+#include "ProbeIsolator.h"
+#include "ProbeServer.h"
+#include "ProbeTimings.h"
+#include "RendererProbe.h"
+#include "ReportCache.h"
+#include "ReportFormatter.h"
+#include "RequirementChecker.h"
 
 #if defined(__EMSCRIPTEN__)
   #include <emscripten/version.h>
 #endif
 
+#include <atomic>
+#include <functional>
 #include <iomanip>
 #include <iostream>
+#include <memory>
+#include <sstream>
 #include <string>
+#include <thread>
 #include <vector>
 
 // On multi-vendor-GPU notebooks, these flags could be used to ask driver
@@ -31,6 +45,31 @@ extern "C" __declspec(dllexport) unsigned long NvOptimusEnablement = 1;
 extern "C" __declspec(dllexport) unsigned long AmdPowerXpressRequestHighPerformance = 1;
 #endif
 
+//! Tool version.
+static const char THE_WGLINFO_VERSION[] = "26.07";
+
+//! Listener printing probing results via report formatter.
+class FormatterListener : public RendererProbe::Listener
+{
+public:
+  FormatterListener(ReportFormatter& theFmt, std::atomic<bool>& theHasFailures)
+  : myFmt(theFmt), myHasFailures(theHasFailures) {}
+
+  virtual void OnPlatform(const RendererReport& theInfo) override { myFmt.BeginPlatform(theInfo); }
+  virtual void OnProfile(const RendererReport& theReport) override { myFmt.WriteProfile(theReport); }
+  virtual void OnPlatformEnd() override { myFmt.EndPlatform(); }
+  virtual void OnVisuals(const RendererReport& theReport) override { myFmt.WriteVisuals(theReport); }
+  virtual void OnError(const std::string& theMessage) override
+  {
+    myHasFailures = true;
+    std::cerr << "Error: " << theMessage << "\n";
+  }
+
+private:
+  ReportFormatter&   myFmt;
+  std::atomic<bool>& myHasFailures;
+};
+
 //! Information tool.
 class WglInfo
 {
@@ -54,15 +93,43 @@ private:
   //! Print help message.
   void printHelp(const char* theName, bool theIsVersion = false);
 
-  //! Print WGL info.
-  template<class Platform_t>
-  std::vector<BaseGlContext::ContextBits> printWglInfo();
+  //! Return probing options defined by command-line arguments.
+  RendererProbe::Options probeOptions() const;
+
+  //! Keep contexts alive and answer queries over UNIX socket.
+  int serve();
+
+  //! Print timings table and write trace file, if requested.
+  //! @return FALSE if trace file cannot be written
+  bool writeTimings();
+
+  //! Run benchmarks on each created profile and print results.
+  //! @return 0 if benchmarks have been executed on at least one context
+  int runBenchmarks();
+
+  //! Run benchmarks on profiles of the probe.
+  //! @return number of contexts benchmarks have been executed on
+  int runBenchmarks(RendererProbe& theProbe, BenchmarkRunner& theRunner, const std::vector<GlBenchmark::Info>& theBenchmarks);
+
+  //! Run context creation benchmark on profiles of the platform.
+  //! @return number of profiles benchmark has been executed on
+  int runContextCreate(RendererProbe::Platform thePlatform, const RendererProbe::Options& theOptions);
+
+  //! Check capability requirements and print one-line result.
+  //! @return 0 if requirements are met, 1 if not and 2 if some isolated probe has failed
+  int checkRequirements();
+
+  //! Return report cache key for command-line arguments.
+  static std::string cacheKey(int theNbArgs, const char** theArgVec);
+
+  //! Print info for all EGL devices (EGL_EXT_device_enumeration) probed concurrently.
+  std::vector<BaseGlContext::ContextBits> printEglDevices(ReportFormatter& theFmt);
 
   //! Returns the CPU architecture used to build the program (may not match the system).
   static const char* getArchString();
 
-  //! Print build and system information.
-  static void printSystemInfo();
+  //! Returns build and system information.
+  static std::string getSystemInfo();
 
 private:
   bool myToShowNgl = true;
@@ -86,6 +153,21 @@ private:
   bool myToPrintExtensions = true;
   bool myToPrintLimits = true;
   bool myToPrintVisuals = true;
+  bool myToPrintTimings = false;
+  ReportFormatter::Format myFormat = ReportFormatter::Format_Text; //!< report format
+  std::vector<std::string> myDeviceVisuals; //!< visuals of EGL devices deferred till the visuals list
+  std::string myTraceFile; //!< file path for Chrome trace-event JSON output
+  bool myIsEglHeadless = false; //!< use surfaceless EGL platform without X11/Wayland window
+  bool myIsEglDevices = false;  //!< enumerate EGL devices
+  bool myIsIsolated = false;    //!< run probes in child processes
+  int  myTimeoutMs = 10000;     //!< per-probe deadline for isolated probes
+  int  myNbJobs = 1;            //!< number of profiles probed concurrently
+  bool myIsCached = false;      //!< answer report from on-disk cache keyed by driver fingerprint
+  std::string myServePath;      //!< UNIX socket path to serve queries on
+  RequirementChecker myRequirements; //!< capability requirements to check instead of printing report
+  std::string myBenchPattern;   //!< patterns of benchmarks to run instead of printing report
+  BenchmarkRunner::Options myBenchOptions; //!< benchmark runner options
+  std::atomic<bool> myHasProbeFailures { false }; //!< some isolated probe has timed out or crashed
 
   int myExitCode = 1;
 };
@@ -98,70 +180,121 @@ int main(int argc, const char** argv)
 
 int WglInfo::Perform(int theNbArgs, const char** theArgVec)
 {
-  printSystemInfo();
-
   myExitCode = 0;
   if (!parseArguments(theNbArgs, theArgVec))
     return myExitCode;
 
-  const std::vector<BaseGlContext::ContextBits> aWglDone =
-    myToShowNgl ? printWglInfo<NativeGlContext>() : std::vector<BaseGlContext::ContextBits>();
-
-  std::vector<BaseGlContext::ContextBits> aEglDone;
-  if (myToShowEgl && (!myIsFirstOnly || aWglDone.empty()))
+#if !defined(_WIN32) && !defined(__APPLE__) && !defined(__EMSCRIPTEN__)
+  // fallback to headless EGL on machines without X11/Wayland server
+  if (myToShowEgl && myEglWin.get() == nullptr && !myIsEglHeadless && !myIsEglDevices)
   {
-    // probably XDG_SESSION_TYPE=wayland should be respected here
-    // instead of trying to connect to Wayland server via WlWindow::HasServer()...
+    const char* anX11Disp = getenv("DISPLAY");
+    myIsEglHeadless = anX11Disp == NULL || *anX11Disp == '\0';
   #ifdef HAVE_WAYLAND
-    if (dynamic_cast<XwWindow*>(myEglWin.get()) != nullptr)
-      aEglDone = printWglInfo<EglGlContextT<XwWindow>>();
-    else if (dynamic_cast<WlWindow*>(myEglWin.get()) != nullptr || WlWindow::HasServer())
-      aEglDone = printWglInfo<EglGlContextT<WlWindow>>();
-    else
-      aEglDone = printWglInfo<EglGlContextT<XwWindow>>();
-  #else
-    aEglDone = printWglInfo<EglGlContextT<NativeWindow>>();
+    myIsEglHeadless = myIsEglHeadless && !WlWindow::HasServer();
   #endif
   }
+#endif
+
+  if (!myServePath.empty())
+    return serve();
+  else if (!myRequirements.IsEmpty())
+    return checkRequirements();
+  else if (!myBenchPattern.empty())
+    return runBenchmarks();
+
+  // cache is bypassed while measuring probes
+  const bool toUseCache = myIsCached && !ProbeTimings::IsEnabled();
+  std::string aCacheKey, aFingerprint;
+  if (toUseCache)
+  {
+    aCacheKey = cacheKey(theNbArgs, theArgVec);
+    aFingerprint = ReportCache::Fingerprint();
+    ReportCache aCache;
+    if (aCache.Open(aCacheKey, aFingerprint))
+    {
+      std::cout.write(aCache.Data(), (std::streamsize)aCache.Size());
+      return myExitCode;
+    }
+  }
+
+  std::ostringstream aCacheOutput;
+  std::unique_ptr<ReportFormatter> aFmt(ReportFormatter::Create(myFormat, toUseCache ? (std::ostream& )aCacheOutput : std::cout));
+  aFmt->BeginDocument(THE_WGLINFO_VERSION, getArchString(), getSystemInfo());
+
+  FormatterListener aListener(*aFmt, myHasProbeFailures);
+  std::unique_ptr<RendererProbe> aWglProbe, anEglProbe;
+  std::vector<BaseGlContext::ContextBits> aWglDone;
+  if (myToShowNgl)
+  {
+    aWglProbe.reset(new RendererProbe(RendererProbe::Platform_Native, probeOptions()));
+    aWglDone = aWglProbe->ProbeProfiles(aListener);
+  }
+
+  std::vector<BaseGlContext::ContextBits> aEglDone;
+  if (myToShowEgl && myIsEglDevices && (!myIsFirstOnly || aWglDone.empty()))
+  {
+    aEglDone = printEglDevices(*aFmt);
+  }
+  else if (myToShowEgl && (!myIsFirstOnly || aWglDone.empty()))
+  {
+    RendererProbe::Options anOpts = probeOptions();
+    anOpts.EglWindow = myEglWin;
+    anEglProbe.reset(new RendererProbe(myIsEglHeadless ? RendererProbe::Platform_EglSurfaceless : RendererProbe::Platform_Egl, anOpts));
+    aEglDone = anEglProbe->ProbeProfiles(aListener);
+  }
 
   if (aWglDone.empty() && aEglDone.empty())
     myExitCode = 1;
 
+  aFmt->BeginVisualsList();
   if (myToPrintVisuals)
   {
     if (!aWglDone.empty())
+      aWglProbe->ProbeVisuals(aWglDone[0], aListener);
+    if (!aEglDone.empty() && !myIsEglDevices) // visuals of devices are printed by printEglDevices()
+      anEglProbe->ProbeVisuals(aEglDone[0], aListener);
+  }
+
+  for (const std::string& aDevVisuals : myDeviceVisuals)
+    aFmt->WriteFragment(aDevVisuals);
+  aFmt->EndDocument();
+
+  // isolated visuals pass may also fail
+  if (myHasProbeFailures)
+    myExitCode = 2;
+
+  if (toUseCache)
+  {
+    std::cout << aCacheOutput.str();
+    if (myExitCode == 0 && !myHasProbeFailures)
     {
-      NativeGlContext aDummy("wglinfo_dummy");
-      if (aDummy.CreateGlContext(aWglDone[0]))
-        aDummy.PrintVisuals(myIsVerbose);
-    }
-    if (!aEglDone.empty())
-    {
-      std::shared_ptr<BaseWindow> anEglWin;
-      if (myEglWin.get() != nullptr)
-      {
-        anEglWin = myEglWin->EmptyCopy("wglinfo_dummy");
-      }
-      else
-      {
-      #ifdef HAVE_WAYLAND
-        if (anEglWin.get() == nullptr && WlWindow::HasServer())
-          anEglWin.reset(new WlWindow("wglinfo_dummy"));
-        else
-          anEglWin.reset(new XwWindow("wglinfo_dummy"));
-      #else
-        anEglWin.reset(new NativeWindow("wglinfo_dummy"));
-      #endif
-      }
-      EglGlContext aDummy(anEglWin);
-      if (aDummy.CreateGlContext(aEglDone[0]))
-        aDummy.PrintVisuals(myIsVerbose);
+      ReportCache aCache;
+      if (!aCache.Store(aCacheKey, aFingerprint, aCacheOutput.str()))
+        std::cerr << "Warning: unable to store report cache within '" << aCache.Directory() << "'\n";
     }
   }
 
+  // terminate displays shared by all probes
+  if (ProbeTimings::IsEnabled())
+    ProbeTimings::SetProbe("");
+  aWglProbe.reset();
+  anEglProbe.reset();
+  if (!writeTimings())
+    myExitCode = 1;
+
   return myExitCode;
 }
 
+bool WglInfo::writeTimings()
+{
+  if (myToPrintTimings)
+    ProbeTimings::PrintTable(myFormat == ReportFormatter::Format_Json ? std::cerr : std::cout);
+
+  return myTraceFile.empty()
+      || ProbeTimings::WriteChromeTrace(myTraceFile);
+}
+
 //! Convert string to lower case.
 static std::string stringToLowerCase(std::string theStr)
 {
@@ -225,6 +358,165 @@ bool WglInfo::parseArguments(int theNbArgs, const char** theArgVec)
     {
       suppressInfoBut(myToPrintGpuMem);
     }
+    else if (anArg == "--timings" || anArg == "-timings")
+    {
+      myToPrintTimings = true;
+      ProbeTimings::SetEnabled(true);
+    }
+    else if (anArg == "--isolate" || anArg == "-isolate")
+    {
+      myIsIsolated = true;
+      if (!ProbeIsolator::IsSupported())
+        std::cerr << "Warning: probes isolation is not supported on this platform\n";
+    }
+    else if ((anArg == "--jobs" || anArg == "-jobs" || anArg == "-j")
+          && anArgIter + 1 < theNbArgs)
+    {
+      myNbJobs = atoi(theArgVec[++anArgIter]);
+      if (myNbJobs <= 0)
+      {
+        std::cerr << "Syntax error! Invalid number of jobs '" << theArgVec[anArgIter] << "'\n\n";
+        myExitCode = 1;
+        return false;
+      }
+      myIsIsolated = myIsIsolated || myNbJobs > 1;
+    }
+    else if ((anArg == "--timeout" || anArg == "-timeout")
+          && anArgIter + 1 < theNbArgs)
+    {
+      myTimeoutMs = atoi(theArgVec[++anArgIter]);
+      if (myTimeoutMs <= 0)
+      {
+        std::cerr << "Syntax error! Invalid timeout '" << theArgVec[anArgIter] << "'\n\n";
+        myExitCode = 1;
+        return false;
+      }
+      myIsIsolated = true;
+      if (!ProbeIsolator::IsSupported())
+        std::cerr << "Warning: probes isolation is not supported on this platform\n";
+    }
+    else if (anArg == "--cache" || anArg == "-cache")
+    {
+      myIsCached = true;
+      if (!ReportCache::IsSupported())
+        std::cerr << "Warning: report cache is not supported on this platform\n";
+    }
+    else if ((anArg == "--serve" || anArg == "-serve")
+          && anArgIter + 1 < theNbArgs)
+    {
+      myServePath = theArgVec[++anArgIter];
+    }
+    else if ((anArg == "--require" || anArg == "-require")
+          && anArgIter + 1 < theNbArgs)
+    {
+      if (!myRequirements.Add(theArgVec[++anArgIter]))
+      {
+        std::cerr << "Syntax error! Invalid requirement '" << theArgVec[anArgIter] << "'\n\n";
+        myExitCode = 3; // distinguish from unmet requirements
+        return false;
+      }
+    }
+    else if ((anArg == "--bench" || anArg == "-bench")
+          && anArgIter + 1 < theNbArgs)
+    {
+      myBenchPattern = theArgVec[++anArgIter];
+    }
+    else if ((anArg == "--bench-warmup" || anArg == "-bench-warmup")
+          && anArgIter + 1 < theNbArgs)
+    {
+      myBenchOptions.NbWarmup = atoi(theArgVec[++anArgIter]);
+      if (myBenchOptions.NbWarmup < 0)
+      {
+        std::cerr << "Syntax error! Invalid number of warmup iterations '" << theArgVec[anArgIter] << "'\n\n";
+        myExitCode = 1;
+        return false;
+      }
+    }
+    else if ((anArg == "--bench-reps" || anArg == "-bench-reps")
+          && anArgIter + 1 < theNbArgs)
+    {
+      myBenchOptions.NbRepetitions = atoi(theArgVec[++anArgIter]);
+      if (myBenchOptions.NbRepetitions <= 0)
+      {
+        std::cerr << "Syntax error! Invalid number of repetitions '" << theArgVec[anArgIter] << "'\n\n";
+        myExitCode = 1;
+        return false;
+      }
+    }
+    else if ((anArg == "--bench-size" || anArg == "-bench-size")
+          && anArgIter + 1 < theNbArgs)
+    {
+      // comma-separated list of WxH or N (square) resolutions
+      const std::string aVal = stringToLowerCase(theArgVec[++anArgIter]);
+      myBenchOptions.Resolutions.clear();
+      for (size_t aStart = 0; aStart <= aVal.size();)
+      {
+        size_t anEnd = aVal.find(',', aStart);
+        if (anEnd == std::string::npos)
+          anEnd = aVal.size();
+
+        const std::string aRes = aVal.substr(aStart, anEnd - aStart);
+        const size_t aSep = aRes.find('x');
+        const int aWidth  = atoi(aRes.c_str());
+        const int aHeight = aSep != std::string::npos ? atoi(aRes.c_str() + aSep + 1) : aWidth;
+        if (aWidth <= 0 || aHeight <= 0)
+        {
+          std::cerr << "Syntax error! Invalid benchmark resolution '" << aRes << "'\n\n";
+          myExitCode = 1;
+          return false;
+        }
+        myBenchOptions.Resolutions.push_back(std::make_pair(aWidth, aHeight));
+        aStart = anEnd + 1;
+      }
+    }
+    else if ((anArg == "--bench-timer" || anArg == "-bench-timer")
+          && anArgIter + 1 < theNbArgs)
+    {
+      const std::string aVal = stringToLowerCase(theArgVec[++anArgIter]);
+      if (aVal == "auto")
+      {
+        myBenchOptions.TimerMode = BenchmarkRunner::Timer_Auto;
+      }
+      else if (aVal == "finish")
+      {
+        myBenchOptions.TimerMode = BenchmarkRunner::Timer_Finish;
+      }
+      else if (aVal == "query")
+      {
+        myBenchOptions.TimerMode = BenchmarkRunner::Timer_Query;
+      }
+      else
+      {
+        std::cerr << "Syntax error! Unknown benchmark timer '" << theArgVec[anArgIter] << "'\n\n";
+        myExitCode = 1;
+        return false;
+      }
+    }
+    else if ((anArg == "--format" || anArg == "-format")
+          && anArgIter + 1 < theNbArgs)
+    {
+      const std::string aVal = stringToLowerCase(theArgVec[++anArgIter]);
+      if (aVal == "text")
+      {
+        myFormat = ReportFormatter::Format_Text;
+      }
+      else if (aVal == "json")
+      {
+        myFormat = ReportFormatter::Format_Json;
+      }
+      else
+      {
+        std::cerr << "Syntax error! Unknown format '" << theArgVec[anArgIter] << "'\n\n";
+        myExitCode = 1;
+        return false;
+      }
+    }
+    else if ((anArg == "--trace-out" || anArg == "-trace-out")
+          && anArgIter + 1 < theNbArgs)
+    {
+      myTraceFile = theArgVec[++anArgIter];
+      ProbeTimings::SetEnabled(true);
+    }
     else if (anArg == "--platform" || anArg == "-platform")
     {
       myToShowNgl = myToShowEgl = false;
@@ -248,6 +540,16 @@ bool WglInfo::parseArguments(int theNbArgs, const char** theArgVec)
           myToShowEgl = true;
           myEglWin.reset(new XwWindow(""));
         }
+        else if (aVal == "egl-surfaceless" || aVal == "egl-headless")
+        {
+          myToShowEgl = true;
+          myIsEglHeadless = true;
+        }
+        else if (aVal == "egl-device" || aVal == "egl-devices")
+        {
+          myToShowEgl = true;
+          myIsEglDevices = true;
+        }
       #endif
         else if (aVal == "egl")
         {
@@ -399,21 +701,27 @@ void WglInfo::printHelp(const char* theName, bool theIsVersion)
 #elif defined(__EMSCRIPTEN__)
     "EGL|EMSDK";
 #elif defined(HAVE_WAYLAND)
-    "EGL|EGL-X11|EGL-WAYLAND|GLX";
+    "EGL|EGL-X11|EGL-WAYLAND|EGL-SURFACELESS|EGL-DEVICE|GLX";
 #else
-    "EGL|GLX";
+    "EGL|EGL-SURFACELESS|EGL-DEVICE|GLX";
 #endif
 
+  std::cout << getSystemInfo() << "\n\n";
   if (theIsVersion)
   {
-    std::cout << aName <<  " version: " << "26.07" << "\n";
+    std::cout << aName <<  " version: " << THE_WGLINFO_VERSION << "\n";
   }
   else
   {
     std::cout <<
       "Usage: " << aName << " [-v] [-h] [--platform {" << aPlatforms << "}]=*\n"
       "               [--api {GL|GLES}]=* [--profile {core|compat|soft}]=*\n"
-      "               [--first] [--gpumemory]\n"
+      "               [--first] [--gpumemory] [--timings] [--trace-out FILE.json]\n"
+      "               [--isolate] [--timeout MS]=10000 [--jobs N]=1\n"
+      "               [--format {text|json}]=text [--cache] [--serve SOCKET]\n"
+      "               [--require EXPR] [--bench PATTERN] [--bench-warmup N]=5\n"
+      "               [--bench-reps N]=50 [--bench-timer {auto|finish|query}]=auto\n"
+      "               [--bench-size WxH[,WxH...]]\n"
       "               [--novisuals] [--noextensions] [--norenderer] [--noplatform]\n"
       "  -B             Brief output, print only the basics.\n"
       "  -v             Print visuals info in verbose form.\n"
@@ -426,6 +734,38 @@ void WglInfo::printHelp(const char* theName, bool theIsVersion)
       "                 by default several main profiles will be evaluated.\n"
       "  --first        Print only first context.\n"
       "  --gpumemory    Print only GPU memory info (suppresses all other info).\n"
+      "  --timings      Print wall/CPU time spent in each context creation and print stage.\n"
+      "  --trace-out    Write Chrome trace-event JSON (chrome://tracing, Perfetto UI)\n"
+      "                 with nested spans of platforms, profiles and driver calls.\n"
+      "  --isolate      Run each probe in a child process, so that hanging or crashing\n"
+      "                 driver is reported as failure (exit code 2) instead of\n"
+      "                 blocking the tool.\n"
+      "  --timeout      Deadline for each isolated probe in milliseconds (implies --isolate).\n"
+      "  --jobs         Number of profiles probed concurrently (implies --isolate);\n"
+      "                 output is printed in the same order as for serial run.\n"
+      "  --format       Report format: human-readable text or a single JSON document.\n"
+      "  --cache        Answer report from on-disk cache ($XDG_CACHE_HOME/wglinfo)\n"
+      "                 while driver stack fingerprint is unchanged;\n"
+      "                 ignored with --timings and --trace-out.\n"
+      "  --serve        Keep one context per platform/profile alive and answer queries\n"
+      "                 (ping, profiles, vendor, renderer, version, limit NAME,\n"
+      "                 extension NAME, gpumemory) over UNIX socket, one per line.\n"
+      "  --require      Check requirement instead of printing report, could be repeated:\n"
+      "                 gl>=4.5, gles>=3.2, ext:NAME, limit:GL_NAME>=VALUE, gpumem>=MIB;\n"
+      "                 probing stops as soon as requirements are met by a context.\n"
+      "                 Prints one-line result; exit code is 0 if requirements are met,\n"
+      "                 1 if not met, 2 on probing errors and 3 on invalid requirement.\n"
+      "  --bench        Run benchmarks matching comma-separated glob patterns (like '*')\n"
+      "                 on each profile instead of printing report;\n"
+      "                 prints median/p95/p99 of submission (CPU) and GPU time per case.\n"
+      "                 'ctx-create' measures full context creation cycle per platform/profile\n"
+      "                 and prints latency histogram of display open, config choice,\n"
+      "                 context creation and first MakeCurrent.\n"
+      "  --bench-warmup Number of warmup iterations of each benchmark case.\n"
+      "  --bench-reps   Number of measured repetitions of each benchmark case.\n"
+      "  --bench-timer  Measure GPU time by GL_TIME_ELAPSED queries or by glFinish().\n"
+      "  --bench-size   Framebuffer resolutions of benchmarks rendering into framebuffer\n"
+      "                 (fbo-clear, readback), like 1920x1080,3840x2160.\n"
       "  --noplatform   Do not print platform (EGL|WGL|GLX|CGL etc.) info.\n"
       "  --norenderer   Do not print renderer info.\n"
       "  --noextensions Do not list extensions.\n"
@@ -435,60 +775,313 @@ void WglInfo::printHelp(const char* theName, bool theIsVersion)
     std::cout << "This wglinfo tool variation has been created by Kirill Gavrilov Tartynskih <kirill@sview.ru>\n";
 }
 
-template<class Platform_t>
-std::vector<BaseGlContext::ContextBits> WglInfo::printWglInfo()
+RendererProbe::Options WglInfo::probeOptions() const
 {
-  std::vector<BaseGlContext::ContextBits> anOptions;
+  RendererProbe::Options anOpts;
+  anOpts.Profiles.clear();
   if (myToShowGl && myIsCompatProfile)
-    anOptions.push_back(BaseGlContext::ContextBits_NONE);
+    anOpts.Profiles.push_back(BaseGlContext::ContextBits_NONE);
 
   if (myToShowGl && myIsCoreProfile)
-    anOptions.push_back(BaseGlContext::ContextBits_CoreProfile);
+    anOpts.Profiles.push_back(BaseGlContext::ContextBits_CoreProfile);
 
   if (myToShowGl && myIsFwdProfile)
-      anOptions.push_back(BaseGlContext::ContextBits_ForwardProfile);
+    anOpts.Profiles.push_back(BaseGlContext::ContextBits_ForwardProfile);
 
   if (myToShowGles)
-    anOptions.push_back(BaseGlContext::ContextBits_GLES);
+    anOpts.Profiles.push_back(BaseGlContext::ContextBits_GLES);
 
   if (myToShowGl && myIsSoftProfile)
-    anOptions.push_back(BaseGlContext::ContextBits_SoftProfile);
+    anOpts.Profiles.push_back(BaseGlContext::ContextBits_SoftProfile);
 
 #if defined(__APPLE__)
   if (myToShowGl && myIsSoftProfile && myIsCoreProfile)
-    anOptions.push_back(BaseGlContext::ContextBits(BaseGlContext::ContextBits_CoreProfile | BaseGlContext::ContextBits_SoftProfile));
+    anOpts.Profiles.push_back(BaseGlContext::ContextBits(BaseGlContext::ContextBits_CoreProfile | BaseGlContext::ContextBits_SoftProfile));
 #endif
 
+  anOpts.Sections = RendererReport::Section_NONE;
+  anOpts.Sections |= myToPrintPlatform   ? RendererReport::Section_Platform   : 0;
+  anOpts.Sections |= myToPrintRenderer   ? RendererReport::Section_Renderer   : 0;
+  anOpts.Sections |= myToPrintGpuMem     ? RendererReport::Section_GpuMemory  : 0;
+  anOpts.Sections |= myToPrintExtensions ? RendererReport::Section_Extensions : 0;
+  anOpts.Sections |= myToPrintLimits     ? RendererReport::Section_Limits     : 0;
+  anOpts.Sections |= myToPrintVisuals    ? RendererReport::Section_Visuals    : 0;
+  anOpts.IsVerbose   = myIsVerbose;
+  anOpts.IsFirstOnly = myIsFirstOnly;
+  anOpts.IsIsolated  = myIsIsolated;
+  anOpts.TimeoutMs   = myTimeoutMs;
+  anOpts.NbJobs      = myNbJobs;
+  return anOpts;
+}
+
+std::vector<BaseGlContext::ContextBits> WglInfo::printEglDevices(ReportFormatter& theFmt)
+{
+  std::vector<void*> aDevices;
+  if (!RendererProbe::QueryEglDevices(aDevices))
+    return std::vector<BaseGlContext::ContextBits>();
+
+  // software profile is not probed on devices, see RendererProbe::IsProfileSupported()
+  const RendererProbe::Options aDevOpts = probeOptions();
+
+  // probe devices concurrently with output buffered per device
+  std::vector<std::string> anOutputs(aDevices.size()), aVisuals(aDevices.size());
+  std::vector<std::vector<BaseGlContext::ContextBits>> aDevicesDone(aDevices.size());
+  std::vector<std::thread> aThreads;
+  for (size_t aDevIter = 0; aDevIter < aDevices.size(); ++aDevIter)
+  {
+    aThreads.emplace_back([this, &aDevOpts, &aDevices, &anOutputs, &aVisuals, &aDevicesDone, aDevIter]()
+    {
+      RendererProbe::Options anOpts = aDevOpts;
+      anOpts.EglDevice = aDevices[aDevIter];
+      anOpts.EglDeviceIndex = (int)aDevIter;
+      RendererProbe aProbe(RendererProbe::Platform_EglSurfaceless, anOpts);
+
+      std::ostringstream anOutput;
+      std::unique_ptr<ReportFormatter> aFmt(ReportFormatter::Create(myFormat, anOutput));
+      FormatterListener aListener(*aFmt, myHasProbeFailures);
+      const std::vector<BaseGlContext::ContextBits> aDone = aProbe.ProbeProfiles(aListener);
+      anOutputs[aDevIter] = anOutput.str();
+      if (myToPrintVisuals && !aDone.empty())
+      {
+        std::ostringstream aVisualsOutput;
+        std::unique_ptr<ReportFormatter> aVisualsFmt(ReportFormatter::Create(myFormat, aVisualsOutput));
+        FormatterListener aVisualsListener(*aVisualsFmt, myHasProbeFailures);
+        aProbe.ProbeVisuals(aDone[0], aVisualsListener);
+        aVisuals[aDevIter] = aVisualsOutput.str();
+      }
+      aDevicesDone[aDevIter] = aDone;
+    });
+  }
+
+  // merge reports in device order
   std::vector<BaseGlContext::ContextBits> aSucceeded;
-  for (size_t anOptIter = 0; anOptIter < anOptions.size(); ++anOptIter)
+  for (size_t aDevIter = 0; aDevIter < aDevices.size(); ++aDevIter)
   {
-    const BaseGlContext::ContextBits anOpt = anOptions[anOptIter];
+    aThreads[aDevIter].join();
+    theFmt.WriteFragment(anOutputs[aDevIter]);
+    if (myFormat == ReportFormatter::Format_Json)
+      myDeviceVisuals.push_back(aVisuals[aDevIter]); // written within visuals list
+    else
+      theFmt.WriteFragment(aVisuals[aDevIter]);
+    aSucceeded.insert(aSucceeded.end(), aDevicesDone[aDevIter].begin(), aDevicesDone[aDevIter].end());
+  }
+  std::cout.flush();
+  return aSucceeded;
+}
 
-    Platform_t aCtx("wglinfo");
-    if (!aCtx.CreateGlContext(anOpt))
-      continue;
+int WglInfo::serve()
+{
+  if (!ProbeServer::IsSupported())
+  {
+    std::cerr << "Error: serving over UNIX socket is not supported on this platform\n";
+    return 1;
+  }
 
-    aSucceeded.push_back(anOpt);
-    if (myToPrintPlatform && aSucceeded.size() == 1)
-      aCtx.PrintPlatformInfo(myToPrintExtensions); // print platform once
+  // daemon answers any query, so that all information is collected regardless of printing options
+  RendererProbe::Options anOpts = probeOptions();
+  anOpts.Sections = RendererReport::Section_ALL;
+  anOpts.IsIsolated = false;
+  anOpts.IsOffscreen = true; // EGL contexts kept alive cannot share a single native window surface
 
-    if (myToPrintRenderer)
-      aCtx.PrintRendererInfo();
+  ProbeServer aServer;
+  if (myToShowNgl)
+    aServer.AddProbe(std::make_shared<RendererProbe>(RendererProbe::Platform_Native, anOpts));
 
-    if (myToPrintGpuMem)
-      aCtx.PrintGpuMemoryInfo();
+  if (myToShowEgl && myIsEglDevices)
+  {
+    std::vector<void*> aDevices;
+    RendererProbe::QueryEglDevices(aDevices);
+    for (size_t aDevIter = 0; aDevIter < aDevices.size(); ++aDevIter)
+    {
+      RendererProbe::Options aDevOpts = anOpts;
+      aDevOpts.EglDevice = aDevices[aDevIter];
+      aDevOpts.EglDeviceIndex = (int)aDevIter;
+      aServer.AddProbe(std::make_shared<RendererProbe>(RendererProbe::Platform_EglSurfaceless, aDevOpts));
+    }
+  }
+  else if (myToShowEgl)
+  {
+    anOpts.EglWindow = myEglWin;
+    aServer.AddProbe(std::make_shared<RendererProbe>(myIsEglHeadless ? RendererProbe::Platform_EglSurfaceless : RendererProbe::Platform_Egl, anOpts));
+  }
+
+  if (aServer.NbContexts() == 0)
+  {
+    std::cerr << "Error: no context has been created\n";
+    return 1;
+  }
 
-    if (myToPrintExtensions)
-      aCtx.PrintExtensions();
+  std::cout << "Serving " << aServer.NbContexts() << " contexts on '" << myServePath << "'\n" << std::flush;
+  return aServer.Serve(myServePath) ? 0 : 1;
+}
 
-    if (myToPrintLimits)
-      aCtx.PrintLimits();
+int WglInfo::runBenchmarks(RendererProbe& theProbe,
+                           BenchmarkRunner& theRunner,
+                           const std::vector<GlBenchmark::Info>& theBenchmarks)
+{
+  int aNbDone = 0;
+  for (BaseGlContext::ContextBits aBits : theProbe.ProbeOptions().Profiles)
+  {
+    std::shared_ptr<BaseGlContext> aCtx = theProbe.CreateContext(aBits);
+    if (aCtx.get() == nullptr
+    || !aCtx->MakeCurrent())
+    {
+      continue;
+    }
 
+    const std::vector<BenchmarkRunner::CaseResult> aResults = theRunner.Run(*aCtx, theBenchmarks);
+    theRunner.PrintTable(std::cout, BaseGlContext::ProbeLabel(aCtx->PlatformName(), aBits), aResults);
+    std::cout.flush();
+    ++aNbDone;
     if (myIsFirstOnly)
-      return aSucceeded;
+      break;
   }
+  return aNbDone;
+}
 
-  return aSucceeded;
+int WglInfo::runContextCreate(RendererProbe::Platform thePlatform, const RendererProbe::Options& theOptions)
+{
+  ContextCreateBenchmark aBench(myBenchOptions);
+  const std::vector<ContextCreateBenchmark::Result> aResults = aBench.Run(thePlatform, theOptions);
+  for (const ContextCreateBenchmark::Result& aResult : aResults)
+    aBench.PrintHistogram(std::cout, aResult);
+  std::cout.flush();
+  return (int)aResults.size();
+}
+
+int WglInfo::runBenchmarks()
+{
+  const std::vector<GlBenchmark::Info> aBenchmarks = GlBenchmark::Find(myBenchPattern);
+  const bool toBenchCreate = GlBenchmark::MatchPattern(myBenchPattern, ContextCreateBenchmark::Name());
+  if (aBenchmarks.empty() && !toBenchCreate)
+  {
+    std::cerr << "Error: no benchmark matches '" << myBenchPattern << "'; available benchmarks:\n";
+    std::cerr << "  " << std::left << std::setw(16) << ContextCreateBenchmark::Name() << " " << ContextCreateBenchmark::Description() << "\n";
+    for (const GlBenchmark::Info& anInfo : GlBenchmark::Registry())
+      std::cerr << "  " << std::left << std::setw(16) << anInfo.Name << " " << anInfo.Description << "\n";
+    return 1;
+  }
+
+  // benchmarks are executed within this process on contexts kept alive by probe;
+  // context creation is measured before, as it terminates the display on each cycle
+  RendererProbe::Options anOpts = probeOptions();
+  anOpts.Sections = RendererReport::Section_NONE;
+  anOpts.IsIsolated = false;
+
+  BenchmarkRunner aRunner(myBenchOptions);
+  int aNbDone = 0;
+  if (myToShowNgl)
+  {
+    if (toBenchCreate)
+      aNbDone += runContextCreate(RendererProbe::Platform_Native, anOpts);
+    if (!aBenchmarks.empty())
+    {
+      RendererProbe aProbe(RendererProbe::Platform_Native, anOpts);
+      aNbDone += runBenchmarks(aProbe, aRunner, aBenchmarks);
+    }
+  }
+
+  if (myToShowEgl && myIsEglDevices && (!myIsFirstOnly || aNbDone == 0))
+  {
+    RendererProbe::Options aDevOpts = probeOptions();
+    aDevOpts.Sections = anOpts.Sections;
+    aDevOpts.IsIsolated = false;
+
+    std::vector<void*> aDevices;
+    RendererProbe::QueryEglDevices(aDevices);
+    for (size_t aDevIter = 0; aDevIter < aDevices.size() && (!myIsFirstOnly || aNbDone == 0); ++aDevIter)
+    {
+      aDevOpts.EglDevice = aDevices[aDevIter];
+      aDevOpts.EglDeviceIndex = (int)aDevIter;
+      if (toBenchCreate)
+        aNbDone += runContextCreate(RendererProbe::Platform_EglSurfaceless, aDevOpts);
+      if (!aBenchmarks.empty())
+      {
+        RendererProbe aProbe(RendererProbe::Platform_EglSurfaceless, aDevOpts);
+        aNbDone += runBenchmarks(aProbe, aRunner, aBenchmarks);
+      }
+    }
+  }
+  else if (myToShowEgl && (!myIsFirstOnly || aNbDone == 0))
+  {
+    anOpts.EglWindow = myEglWin;
+    const RendererProbe::Platform aPlatform = myIsEglHeadless ? RendererProbe::Platform_EglSurfaceless : RendererProbe::Platform_Egl;
+    if (toBenchCreate)
+      aNbDone += runContextCreate(aPlatform, anOpts);
+    if (!aBenchmarks.empty())
+    {
+      RendererProbe aProbe(aPlatform, anOpts);
+      aNbDone += runBenchmarks(aProbe, aRunner, aBenchmarks);
+    }
+  }
+
+  if (ProbeTimings::IsEnabled())
+    ProbeTimings::SetProbe("");
+  if (!writeTimings())
+    return 1;
+  return aNbDone != 0 ? 0 : 1;
+}
+
+int WglInfo::checkRequirements()
+{
+  // collect only information needed to evaluate requirements;
+  // profiles and platforms are probed till requirements are met
+  RendererProbe::Options anOpts = probeOptions();
+  anOpts.Sections = myRequirements.Sections();
+  anOpts.IsFirstOnly = false;
+  if (myToShowNgl)
+  {
+    RendererProbe aProbe(RendererProbe::Platform_Native, anOpts);
+    aProbe.ProbeProfiles(myRequirements);
+  }
+
+  if (myToShowEgl && myIsEglDevices && !myRequirements.IsSatisfied())
+  {
+    RendererProbe::Options aDevOpts = probeOptions();
+    aDevOpts.Sections = anOpts.Sections;
+    aDevOpts.IsFirstOnly = false;
+
+    std::vector<void*> aDevices;
+    RendererProbe::QueryEglDevices(aDevices);
+    for (size_t aDevIter = 0; aDevIter < aDevices.size() && !myRequirements.IsSatisfied(); ++aDevIter)
+    {
+      aDevOpts.EglDevice = aDevices[aDevIter];
+      aDevOpts.EglDeviceIndex = (int)aDevIter;
+      RendererProbe aProbe(RendererProbe::Platform_EglSurfaceless, aDevOpts);
+      aProbe.ProbeProfiles(myRequirements);
+    }
+  }
+  else if (myToShowEgl && !myRequirements.IsSatisfied())
+  {
+    anOpts.EglWindow = myEglWin;
+    RendererProbe aProbe(myIsEglHeadless ? RendererProbe::Platform_EglSurfaceless : RendererProbe::Platform_Egl, anOpts);
+    aProbe.ProbeProfiles(myRequirements);
+  }
+
+  std::cout << myRequirements.Reason() << "\n";
+  for (const std::string& anError : myRequirements.Errors())
+    std::cerr << "Error: " << anError << "\n";
+
+  if (ProbeTimings::IsEnabled())
+    ProbeTimings::SetProbe("");
+  if (!writeTimings())
+    return 1;
+
+  if (myRequirements.IsSatisfied())
+    return 0;
+  return myRequirements.Errors().empty() ? 1 : 2;
+}
+
+std::string WglInfo::cacheKey(int theNbArgs, const char** theArgVec)
+{
+  std::string aKey = std::string("wglinfo ") + THE_WGLINFO_VERSION + "\n";
+  for (int anArgIter = 1; anArgIter < theNbArgs; ++anArgIter)
+  {
+    const std::string anArg = stringToLowerCase(theArgVec[anArgIter]);
+    if (anArg != "--cache" && anArg != "-cache")
+      aKey += std::string(theArgVec[anArgIter]) + "\n";
+  }
+  return aKey;
 }
 
 const char* WglInfo::getArchString()
@@ -526,40 +1119,41 @@ const char* WglInfo::getArchString()
 #endif
 }
 
-void WglInfo::printSystemInfo()
+std::string WglInfo::getSystemInfo()
 {
-  std::cout << "wglinfo " << getArchString();
+  std::stringstream aStr;
+  aStr << "wglinfo " << getArchString();
 #if defined(WGLINFO_FORCE_DISCRETE_GPU)
-  std::cout << " [dgpu]";
+  aStr << " [dgpu]";
 #endif
-  std::cout << " (built with ";
+  aStr << " (built with ";
 #if defined(__INTEL_COMPILER)
-  std::cout << "Intel " << __INTEL_COMPILER << "";
+  aStr << "Intel " << __INTEL_COMPILER << "";
 #elif defined(__BORLANDC__)
-  std::cout << "Borland C++";
+  aStr << "Borland C++";
 #elif defined(__clang__)
-  std::cout << "Clang " << __clang_major__ << "." << __clang_minor__ << "." << __clang_patchlevel__;
+  aStr << "Clang " << __clang_major__ << "." << __clang_minor__ << "." << __clang_patchlevel__;
 #elif defined(_MSC_VER)
 #if _MSC_VER < 1900
-  std::cout << "MS Visual C++ " << int(_MSC_VER / 100 - 6) << "." << int((_MSC_VER / 10) - 60 - 10 * (int)(_MSC_VER / 100 - 6));
+  aStr << "MS Visual C++ " << int(_MSC_VER / 100 - 6) << "." << int((_MSC_VER / 10) - 60 - 10 * (int)(_MSC_VER / 100 - 6));
 #else
-  std::cout << "MS Visual C++ " << int(_MSC_VER / 100 - 5) << "." << int((_MSC_VER / 10) - 50 - 10 * (int)(_MSC_VER / 100 - 5));
+  aStr << "MS Visual C++ " << int(_MSC_VER / 100 - 5) << "." << int((_MSC_VER / 10) - 50 - 10 * (int)(_MSC_VER / 100 - 5));
 #endif
 #elif defined(__GNUC__)
-  std::cout << "GCC " << __GNUC__ << "." << __GNUC_MINOR__ << "." << __GNUC_PATCHLEVEL__ << "";
+  aStr << "GCC " << __GNUC__ << "." << __GNUC_MINOR__ << "." << __GNUC_PATCHLEVEL__ << "";
 #else
-  std::cout << "unrecognized";
+  aStr << "unrecognized";
 #endif
 
 #if defined(__MINGW64__)
-  std::cout << "; MinGW64 " << __MINGW64_VERSION_MAJOR << "." << __MINGW64_VERSION_MINOR;
+  aStr << "; MinGW64 " << __MINGW64_VERSION_MAJOR << "." << __MINGW64_VERSION_MINOR;
 #elif defined(__MINGW32__)
-  std::cout << "; MinGW32 " << __MINGW32_MAJOR_VERSION << "." << __MINGW32_MINOR_VERSION;
+  aStr << "; MinGW32 " << __MINGW32_MAJOR_VERSION << "." << __MINGW32_MINOR_VERSION;
 #elif defined(__EMSCRIPTEN__)
-  std::cout << "; Emscripten SDK " << __EMSCRIPTEN_major__ << "." << __EMSCRIPTEN_minor__ << "." << __EMSCRIPTEN_tiny__;
+  aStr << "; Emscripten SDK " << __EMSCRIPTEN_major__ << "." << __EMSCRIPTEN_minor__ << "." << __EMSCRIPTEN_tiny__;
 #endif
 
-  std::cout << ")";
+  aStr << ")";
 
 #ifdef _WIN32
   // suppress GetVersionExW is deprecated warning
@@ -571,14 +1165,14 @@ void WglInfo::printSystemInfo()
   aVerInfo.dwOSVersionInfoSize = sizeof(aVerInfo);
   if (GetVersionExA((OSVERSIONINFOA*)&aVerInfo))
   {
-    std::cout << " running on Windows " << aVerInfo.dwMajorVersion << "." << aVerInfo.dwMinorVersion << " [" << aVerInfo.dwBuildNumber << "]";
+    aStr << " running on Windows " << aVerInfo.dwMajorVersion << "." << aVerInfo.dwMinorVersion << " [" << aVerInfo.dwBuildNumber << "]";
   }
 #ifdef _MSC_VER
 #pragma warning(pop)
 #endif
 #elif defined(__APPLE__)
-  std::cout << " running on macOS " << CocoaWindow::GetOsVersion();
+  aStr << " running on macOS " << CocoaWindow::GetOsVersion();
 #endif
 
-  std::cout << "\n\n";
+  return aStr.str();
 }